@@ -0,0 +1,26 @@
+#include <iomanip>
+#include <iostream>
+#include "Benchmark.h"
+
+namespace minesweeper {
+    Benchmark::Benchmark(double budget) : budget(budget) {
+
+    }
+
+    void Benchmark::section(const std::string &name) {
+        std::cout << std::endl << name << std::endl
+                  << std::left << std::setw(24) << "size" << std::right << std::setw(12) << "cells"
+                  << std::setw(8) << "runs" << std::setw(14) << "best ms" << std::setw(14) << "median ms"
+                  << std::setw(12) << "ns/cell" << std::endl;
+    }
+
+    void Benchmark::report(const std::string &label, long cells, std::vector<double> &times) {
+        std::sort(times.begin(), times.end());
+        double best = times.front();
+        double median = times[times.size() / 2];
+        std::cout << std::left << std::setw(24) << label << std::right << std::setw(12) << cells
+                  << std::setw(8) << times.size() << std::fixed << std::setprecision(4)
+                  << std::setw(14) << best * 1e3 << std::setw(14) << median * 1e3
+                  << std::setprecision(2) << std::setw(12) << best * 1e9 / static_cast<double>(cells) << std::endl;
+    }
+}
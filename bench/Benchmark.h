@@ -0,0 +1,41 @@
+#ifndef MINESWEEPER_BENCHMARK_H
+#define MINESWEEPER_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace minesweeper {
+    class Benchmark {
+    public:
+        explicit Benchmark(double budget);
+        void section(const std::string &name);
+        template<typename Setup, typename Run>
+        void measure(const std::string &label, long cells, Setup setup, Run run);
+    private:
+        static constexpr int MIN_RUNS = 5;
+        static constexpr int MAX_RUNS = 10000;
+        using clock_t = std::chrono::steady_clock;
+        double budget;
+        void report(const std::string &label, long cells, std::vector<double> &times);
+    };
+
+    // repeats setup (untimed) and run (timed) until the time budget is spent, then reports the best and median run
+    template<typename Setup, typename Run>
+    void Benchmark::measure(const std::string &label, long cells, Setup setup, Run run) {
+        std::vector<double> times;
+        double spent = 0;
+        for (int runs = 0; runs < MAX_RUNS && (runs < MIN_RUNS || spent < budget); runs++) {
+            setup();
+            auto start = clock_t::now();
+            run();
+            double seconds = std::chrono::duration<double>(clock_t::now() - start).count();
+            times.push_back(seconds);
+            spent += seconds;
+        }
+        report(label, cells, times);
+    }
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include <vector>
+#include "EngineBench.h"
+#include "../engine/AdjacencyKernel.h"
+#include "../engine/MineField.h"
+#include "../util/Random.h"
+
+namespace minesweeper {
+    EngineBench::EngineBench(Benchmark &benchmark, int maxSide) : benchmark(benchmark), maxSide(maxSide) {
+
+    }
+
+    void EngineBench::run() {
+        for (double density : {0.01, 0.2, 0.5, 0.9})
+            reset(density);
+        adjacency(0.2);
+        flood(0.01);
+        flood(0.1);
+        chord(0.15);
+    }
+
+    void EngineBench::reset(double density) {
+        benchmark.section("MineField::reset, density " + getPercent(density));
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            Options options{getOptions(side, density)};
+            MineField mineField{options, 1};
+            uint64_t seed = 1;
+            benchmark.measure(getLabel(side), options.getTiles(), [] {}, [&mineField, &seed] {
+                mineField.reset(seed++);
+            });
+        }
+    }
+
+    void EngineBench::adjacency(double density) {
+        benchmark.section("AdjacencyKernel::compute, density " + getPercent(density));
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            int wordsPerRow = (side + 63) / 64;
+            std::vector<uint64_t> mines(side * wordsPerRow);
+            std::vector<uint8_t> counts(side * side);
+            Random random{1};
+            auto threshold = static_cast<uint32_t>(density * 4294967296.0);
+            for (int r = 0; r < side; r++)
+                for (int c = 0; c < side; c++)
+                    if (static_cast<uint32_t>(random() >> 32) < threshold)
+                        mines[r * wordsPerRow + c / 64] |= uint64_t{1} << (c % 64);
+            AdjacencyKernel kernel{side, side};
+            benchmark.measure(getLabel(side), side * side, [] {}, [&kernel, &mines, &counts, wordsPerRow] {
+                kernel.compute(mines.data(), wordsPerRow, counts.data());
+            });
+        }
+    }
+
+    // reveals every opening on the board, so each cascade runs through a whole zero region
+    void EngineBench::flood(double density) {
+        benchmark.section("Board::reveal flood, density " + getPercent(density));
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            Options options{getOptions(side, density)};
+            Board board{options, 1};
+            uint64_t seed = 1;
+            benchmark.measure(getLabel(side), options.getTiles(), [&board, &seed] { board.reset(seed++); }, [&] {
+                for (int r = 0; r < options.getRows(); r++)
+                    for (int c = 0; c < options.getColumns(); c++)
+                        if (!board.isRevealed(r, c) && !board.isMine(r, c) && board.getAdjacentMines(r, c) == 0)
+                            board.reveal(r, c);
+            });
+        }
+    }
+
+    // one pass of chords over every revealed cell once all mines are flagged
+    void EngineBench::chord(double density) {
+        benchmark.section("Board::clear chord sweep, density " + getPercent(density));
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            Options options{getOptions(side, density)};
+            Board board{options, 1};
+            uint64_t seed = 1;
+            auto setup = [&board, &options, &seed] {
+                board.reset(seed++);
+                openZero(board, options);
+                for (int r = 0; r < options.getRows(); r++)
+                    for (int c = 0; c < options.getColumns(); c++)
+                        if (board.isMine(r, c))
+                            board.toggleFlag(r, c);
+            };
+            benchmark.measure(getLabel(side), options.getTiles(), setup, [&board, &options] {
+                for (int r = 0; r < options.getRows(); r++)
+                    for (int c = 0; c < options.getColumns(); c++)
+                        if (board.isRevealed(r, c))
+                            board.clear(r, c);
+            });
+        }
+    }
+
+    std::string EngineBench::getLabel(int side) {
+        return std::to_string(side) + "x" + std::to_string(side);
+    }
+
+    std::string EngineBench::getPercent(double density) {
+        return std::to_string(static_cast<int>(density * 100 + 0.5)) + "%";
+    }
+
+    Options EngineBench::getOptions(int side, double density) {
+        return Options::getOptions(side, side, static_cast<int>(side * side * density));
+    }
+
+    void EngineBench::openZero(Board &board, const Options &options) {
+        for (int r = 0; r < options.getRows(); r++) {
+            for (int c = 0; c < options.getColumns(); c++) {
+                if (!board.isMine(r, c) && board.getAdjacentMines(r, c) == 0) {
+                    board.reveal(r, c);
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef MINESWEEPER_ENGINEBENCH_H
+#define MINESWEEPER_ENGINEBENCH_H
+
+#include <string>
+#include "Benchmark.h"
+#include "../config/Options.h"
+#include "../engine/Board.h"
+
+namespace minesweeper {
+    class EngineBench {
+    public:
+        EngineBench(Benchmark &benchmark, int maxSide);
+        void run();
+    private:
+        static constexpr int MIN_SIDE = 32;
+        Benchmark &benchmark;
+        int maxSide;
+        void reset(double density);
+        void adjacency(double density);
+        void flood(double density);
+        void chord(double density);
+        static std::string getLabel(int side);
+        static std::string getPercent(double density);
+        static Options getOptions(int side, double density);
+        static void openZero(Board &board, const Options &options);
+    };
+};
+
+#endif
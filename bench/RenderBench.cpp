@@ -0,0 +1,63 @@
+#include <iostream>
+#include <string>
+#include "SDL.h"
+#include "RenderBench.h"
+#include "../config/Layout.h"
+#include "../config/Options.h"
+#include "../engine/Board.h"
+#include "../sdl/ImageRepo.h"
+#include "../sdl/Renderer.h"
+#include "../sdl/Window.h"
+#include "../sprite/Game.h"
+#include "../sprite/Grid.h"
+
+namespace minesweeper {
+    RenderBench::RenderBench(Benchmark &benchmark, int maxSide) : benchmark(benchmark), maxSide(maxSide) {
+
+    }
+
+    // runs under the dummy video driver unless SDL_VIDEODRIVER says otherwise, so no display is needed
+    void RenderBench::run() {
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+        if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+            std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+            return;
+        }
+        frame();
+        construction();
+        SDL_Quit();
+    }
+
+    void RenderBench::frame() {
+        benchmark.section("Game::render full frame");
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            Options options{Options::getOptions(side, side, static_cast<int>(side * side * DENSITY))};
+            Layout layout{options};
+            Window window{layout.getWindow()};
+            Renderer renderer{window.createRenderer()};
+            ImageRepo imageRepo{renderer.createImageRepo("images/")};
+            Game game{imageRepo, renderer, options, layout, Mode::CUSTOM, 1, false};
+            benchmark.measure(std::to_string(side) + "x" + std::to_string(side), options.getTiles(), [] {}, [&game] {
+                game.invalidate();
+                game.render();
+            });
+        }
+    }
+
+    void RenderBench::construction() {
+        benchmark.section("Grid construction");
+        for (int side = MIN_SIDE; side <= maxSide; side *= 2) {
+            Options options{Options::getOptions(side, side, static_cast<int>(side * side * DENSITY))};
+            Layout layout{options};
+            Window window{layout.getWindow()};
+            Renderer renderer{window.createRenderer()};
+            ImageRepo imageRepo{renderer.createImageRepo("images/")};
+            Board board{options, 1};
+            GridPtr grid;
+            auto setup = [&grid] { grid.reset(); };
+            benchmark.measure(std::to_string(side) + "x" + std::to_string(side), options.getTiles(), setup, [&] {
+                grid = std::make_shared<Grid>(imageRepo, board, options, layout);
+            });
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef MINESWEEPER_RENDERBENCH_H
+#define MINESWEEPER_RENDERBENCH_H
+
+#include "Benchmark.h"
+
+namespace minesweeper {
+    class RenderBench {
+    public:
+        RenderBench(Benchmark &benchmark, int maxSide);
+        void run();
+    private:
+        static constexpr int MIN_SIDE = 32;
+        static constexpr double DENSITY = 0.15;
+        Benchmark &benchmark;
+        int maxSide;
+        void frame();
+        void construction();
+    };
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef MINESWEEPER_GEOMETRY_H
+#define MINESWEEPER_GEOMETRY_H
+
+#include <algorithm>
+#include <utility>
+#include "Options.h"
+
+namespace minesweeper {
+    // a board shape fixed at compile time, so index arithmetic and neighbor loops fold into constants
+    template<int ROWS, int COLUMNS>
+    class FixedGeometry {
+    public:
+        [[nodiscard]] static constexpr int getRows();
+        [[nodiscard]] static constexpr int getColumns();
+        [[nodiscard]] static constexpr int getTiles();
+        template<typename Fn>
+        static void forEachNeighbor(int n, Fn &&fn);
+    private:
+        static constexpr int OFFSETS[] = {-COLUMNS - 1, -COLUMNS, -COLUMNS + 1, -1, 1, COLUMNS - 1, COLUMNS,
+                                          COLUMNS + 1};
+    };
+
+    // any other shape, read from the options at run time
+    class DynamicGeometry {
+    public:
+        explicit DynamicGeometry(const Options &options);
+        [[nodiscard]] int getRows() const;
+        [[nodiscard]] int getColumns() const;
+        [[nodiscard]] int getTiles() const;
+        template<typename Fn>
+        void forEachNeighbor(int n, Fn &&fn) const;
+    private:
+        const Options &options;
+    };
+
+    using BeginnerGeometry = FixedGeometry<9, 9>;
+    using IntermediateGeometry = FixedGeometry<16, 16>;
+    using ExpertGeometry = FixedGeometry<16, 30>;
+
+    template<int ROWS, int COLUMNS>
+    [[nodiscard]] constexpr int FixedGeometry<ROWS, COLUMNS>::getRows() {
+        return ROWS;
+    }
+
+    template<int ROWS, int COLUMNS>
+    [[nodiscard]] constexpr int FixedGeometry<ROWS, COLUMNS>::getColumns() {
+        return COLUMNS;
+    }
+
+    template<int ROWS, int COLUMNS>
+    [[nodiscard]] constexpr int FixedGeometry<ROWS, COLUMNS>::getTiles() {
+        return ROWS * COLUMNS;
+    }
+
+    template<int ROWS, int COLUMNS>
+    template<typename Fn>
+    void FixedGeometry<ROWS, COLUMNS>::forEachNeighbor(int n, Fn &&fn) {
+        int row = n / COLUMNS;
+        int col = n % COLUMNS;
+        if (row > 0 && row < ROWS - 1 && col > 0 && col < COLUMNS - 1) {
+            for (int offset : OFFSETS)
+                fn(n + offset);
+            return;
+        }
+        for (int r = std::max(row - 1, 0); r <= std::min(row + 1, ROWS - 1); r++)
+            for (int c = std::max(col - 1, 0); c <= std::min(col + 1, COLUMNS - 1); c++)
+                if (r != row || c != col)
+                    fn(r * COLUMNS + c);
+    }
+
+    inline DynamicGeometry::DynamicGeometry(const Options &options) : options(options) {
+
+    }
+
+    [[nodiscard]] inline int DynamicGeometry::getRows() const {
+        return options.getRows();
+    }
+
+    [[nodiscard]] inline int DynamicGeometry::getColumns() const {
+        return options.getColumns();
+    }
+
+    [[nodiscard]] inline int DynamicGeometry::getTiles() const {
+        return options.getTiles();
+    }
+
+    template<typename Fn>
+    void DynamicGeometry::forEachNeighbor(int n, Fn &&fn) const {
+        options.forEachNeighbor(n, std::forward<Fn>(fn));
+    }
+
+    // calls fn once with the geometry for the board's shape: the standard modes get their compile-time
+    // specialization, whatever mode or replay produced the options, and every other shape the dynamic one
+    template<typename Fn>
+    decltype(auto) withGeometry(const Options &options, Fn &&fn) {
+        auto is = [&options](auto geometry) {
+            return options.getRows() == geometry.getRows() && options.getColumns() == geometry.getColumns();
+        };
+        if (is(ExpertGeometry{}))
+            return fn(ExpertGeometry{});
+        if (is(IntermediateGeometry{}))
+            return fn(IntermediateGeometry{});
+        if (is(BeginnerGeometry{}))
+            return fn(BeginnerGeometry{});
+        return fn(DynamicGeometry{options});
+    }
+}
+
+#endif
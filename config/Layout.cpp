@@ -1,7 +1,15 @@
+#include <algorithm>
 #include "Layout.h"
 
 namespace minesweeper {
-    Layout::Layout(Mode::Enum mode) : mode(mode) {
+    Layout::Layout(const Options &options) :
+            gridWidth(options.getColumns() * TILE_SIDE),
+            gridHeight(options.getRows() * TILE_SIDE),
+            viewWidth(std::min(gridWidth, MAX_VIEW_WIDTH)),
+            viewHeight(std::min(gridHeight, MAX_VIEW_HEIGHT)),
+            windowWidth(std::max(viewWidth, MIN_VIEW_WIDTH) + 2 * GRID_LEFT),
+            windowHeight(GRID_TOP + viewHeight + GRID_BOTTOM),
+            digitPanelOffset(viewWidth > MIN_VIEW_WIDTH ? WIDE_DIGIT_PANEL_OFFSET : NARROW_DIGIT_PANEL_OFFSET) {
 
     }
 
@@ -14,11 +22,11 @@ namespace minesweeper {
     }
 
     [[nodiscard]] SDL_Rect Layout::getFlagsDigitPanel() const {
-        return getDigitPanel(DIGIT_PANEL_OFFSET[mode], FLAGS_TOP);
+        return getDigitPanel(digitPanelOffset, FLAGS_TOP);
     }
 
     [[nodiscard]] SDL_Rect Layout::getTimerDigitPanel() const {
-        return getDigitPanel(WINDOW_WIDTH[mode] - DIGIT_PANEL_OFFSET[mode] - DIGIT_PANEL_WIDTH, TIMER_TOP);
+        return getDigitPanel(windowWidth - digitPanelOffset - DIGIT_PANEL_WIDTH, TIMER_TOP);
     }
 
     [[nodiscard]] SDL_Rect Layout::getDigit(int left, int top, int position) const {
@@ -30,15 +38,15 @@ namespace minesweeper {
     }
 
     [[nodiscard]] SDL_Rect Layout::getFlagsDigit(int position) const {
-        return getDigit(DIGIT_PANEL_OFFSET[mode], FLAGS_TOP, position);
+        return getDigit(digitPanelOffset, FLAGS_TOP, position);
     }
 
     [[nodiscard]] SDL_Rect Layout::getTimerDigit(int position) const {
-        return getDigit(WINDOW_WIDTH[mode] - DIGIT_PANEL_OFFSET[mode] - DIGIT_PANEL_WIDTH, TIMER_TOP, position);
+        return getDigit(windowWidth - digitPanelOffset - DIGIT_PANEL_WIDTH, TIMER_TOP, position);
     }
 
     [[nodiscard]] SDL_Rect Layout::getFace() const {
-        return {WINDOW_WIDTH[mode] / 2 - FACE_WIDTH / 2, FACE_TOP, FACE_WIDTH, FACE_HEIGHT};
+        return {windowWidth / 2 - FACE_WIDTH / 2, FACE_TOP, FACE_WIDTH, FACE_HEIGHT};
     }
 
     [[nodiscard]] SDL_Rect Layout::getTile(int gridX, int gridY, int row, int col) const {
@@ -46,19 +54,22 @@ namespace minesweeper {
     }
 
     [[nodiscard]] SDL_Rect Layout::getGrid() const {
-        return {
-                GRID_LEFT,
-                GRID_TOP,
-                COLUMNS[mode] * TILE_SIDE,
-                ROWS[mode] * TILE_SIDE};
+        return {GRID_LEFT, GRID_TOP, viewWidth, viewHeight};
+    }
+
+    [[nodiscard]] int Layout::getGridWidth() const {
+        return gridWidth;
+    }
+
+    [[nodiscard]] int Layout::getGridHeight() const {
+        return gridHeight;
     }
 
     [[nodiscard]] SDL_Rect Layout::getBackground() const {
-        return {0, 0, WINDOW_WIDTH[mode], WINDOW_HEIGHT[mode]};
+        return {0, 0, windowWidth, windowHeight};
     }
 
     [[nodiscard]] SDL_Rect Layout::getWindow() const {
-        return {WINDOW_LEFT, WINDOW_TOP, WINDOW_WIDTH[mode], WINDOW_HEIGHT[mode]};
+        return {WINDOW_LEFT, WINDOW_TOP, windowWidth, windowHeight};
     }
 }
-
@@ -2,12 +2,12 @@
 #define MINESWEEPER_LAYOUT_H
 
 #import "SDL.h"
-#import "Mode.h"
+#import "Options.h"
 
 namespace minesweeper {
     class Layout {
     public:
-        explicit Layout(Mode::Enum mode);
+        explicit Layout(const Options &options);
         static int getTileSide();
         [[nodiscard]] SDL_Rect getDigitPanel(int left, int top) const;
         [[nodiscard]] SDL_Rect getFlagsDigitPanel() const;
@@ -18,23 +18,25 @@ namespace minesweeper {
         [[nodiscard]] SDL_Rect getFace() const;
         [[nodiscard]] SDL_Rect getTile(int gridX, int gridY, int row, int col) const;
         [[nodiscard]] SDL_Rect getGrid() const;
+        [[nodiscard]] int getGridWidth() const;
+        [[nodiscard]] int getGridHeight() const;
         [[nodiscard]] SDL_Rect getBackground() const;
         [[nodiscard]] SDL_Rect getWindow() const;
     private:
-        static constexpr int ROWS[]{9, 16, 16};
-        static constexpr int COLUMNS[]{9, 16, 30};
-        static constexpr int WINDOW_WIDTH[]{210, 350, 630};
-        static constexpr int WINDOW_HEIGHT[]{276, 416, 416};
         static constexpr int WINDOW_LEFT = 100;
         static constexpr int WINDOW_TOP = 100;
         static constexpr int TILE_SIDE = 20;
+        static constexpr int MIN_VIEW_WIDTH = 9 * TILE_SIDE;
+        static constexpr int MAX_VIEW_WIDTH = 60 * TILE_SIDE;
+        static constexpr int MAX_VIEW_HEIGHT = 40 * TILE_SIDE;
         static constexpr int DIGIT_PANEL_WIDTH = 65;
         static constexpr int DIGIT_PANEL_HEIGHT = 37;
         static constexpr int DIGIT_WIDTH = 19;
         static constexpr int DIGIT_HEIGHT = 33;
         static constexpr int DIGIT_PANEL_HORZ_MARGIN = (DIGIT_PANEL_WIDTH - (3 * DIGIT_WIDTH)) / 4;
         static constexpr int DIGIT_PANEL_VERT_MARGIN = (DIGIT_PANEL_HEIGHT - DIGIT_HEIGHT) / 2;
-        static constexpr int DIGIT_PANEL_OFFSET[]{16, 20, 20};
+        static constexpr int NARROW_DIGIT_PANEL_OFFSET = 16;
+        static constexpr int WIDE_DIGIT_PANEL_OFFSET = 20;
         static constexpr int TIMER_TOP = 21;
         static constexpr int FLAGS_TOP = 21;
         static constexpr int FACE_WIDTH = 42;
@@ -42,7 +44,14 @@ namespace minesweeper {
         static constexpr int FACE_TOP = 19;
         static constexpr int GRID_LEFT = 15;
         static constexpr int GRID_TOP = 81;
-        const Mode::Enum mode;
+        static constexpr int GRID_BOTTOM = 15;
+        const int gridWidth;
+        const int gridHeight;
+        const int viewWidth;
+        const int viewHeight;
+        const int windowWidth;
+        const int windowHeight;
+        const int digitPanelOffset;
     };
 }
 
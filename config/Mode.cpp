@@ -1,14 +1,43 @@
 #include "Mode.h"
 
 namespace minesweeper {
+    // any character that names no mode plays expert
     Mode::Enum Mode::parse(const char mode) {
+        Mode::Enum result = Mode::EXPERT;
+        parse(mode, result);
+        return result;
+    }
+
+    // false, leaving the result alone, for a character that names no mode
+    bool Mode::parse(const char mode, Mode::Enum &result) {
         switch (mode) {
             case 'b':
-                return Mode::BEGINNER;
+                result = Mode::BEGINNER;
+                return true;
             case 'i':
-                return Mode::INTERMEDIATE;
+                result = Mode::INTERMEDIATE;
+                return true;
+            case 'e':
+                result = Mode::EXPERT;
+                return true;
+            case 'c':
+                result = Mode::CUSTOM;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    const char *Mode::getName(Mode::Enum mode) {
+        switch (mode) {
+            case Mode::BEGINNER:
+                return "beginner";
+            case Mode::INTERMEDIATE:
+                return "intermediate";
+            case Mode::CUSTOM:
+                return "custom";
             default:
-                return Mode::EXPERT;
+                return "expert";
         }
     }
 }
\ No newline at end of file
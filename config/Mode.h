@@ -7,10 +7,13 @@ namespace minesweeper {
         enum Enum {
             BEGINNER,
             INTERMEDIATE,
-            EXPERT
+            EXPERT,
+            CUSTOM
         };
 
         static Mode::Enum parse(char mode);
+        static bool parse(char mode, Mode::Enum &result);
+        static const char *getName(Mode::Enum mode);
     };
 }
 
@@ -1,50 +1,36 @@
+#include <algorithm>
+#include "Geometry.h"
 #include "Options.h"
 
 namespace minesweeper {
-    Options::Options(int rows, int columns, int mines) : rows(rows), columns(columns), mines(mines) {
+    Options::Options(int rows, int columns, int mines) :
+            rows(rows),
+            columns(columns),
+            mines(mines),
+            offsets{-columns - 1, -columns, -columns + 1, -1, 1, columns - 1, columns, columns + 1} {
 
     }
 
-    [[nodiscard]] int Options::getTiles() const {
-        return rows * columns;
-    }
-
-    [[nodiscard]] int Options::getMines() const {
-        return mines;
-    }
-
-    [[nodiscard]] int Options::getBlanks() const {
-        return getTiles() - mines;
-    }
-
-    [[nodiscard]] int Options::getRows() const {
-        return rows;
-    }
-
-    [[nodiscard]] int Options::getColumns() const {
-        return columns;
-    }
-
-    void Options::forEachNeighbor(int row, int col, const std::function<void(int, int)> &fn) const {
-        for (int r = row - 1; r <= row + 1; r++) {
-            for (int c = col - 1; c <= col + 1; c++) {
-                if (r != row || c != col) {
-                    if (r >= 0 && r < rows && c >= 0 && c < columns) {
-                        fn(r, c);
-                    }
-                }
-            }
-        }
-    }
-
     Options Options::getOptions(Mode::Enum mode) {
         switch (mode) {
             case Mode::BEGINNER:
-                return Options{9, 9, 10};
+                return Options{BeginnerGeometry::getRows(), BeginnerGeometry::getColumns(), 10};
             case Mode::INTERMEDIATE:
-                return Options{16, 16, 40};
+                return Options{IntermediateGeometry::getRows(), IntermediateGeometry::getColumns(), 40};
             default:
-                return Options{16, 30, 99};
+                return Options{ExpertGeometry::getRows(), ExpertGeometry::getColumns(), 99};
         }
     }
+
+    Options Options::getOptions(int rows, int columns, int mines) {
+        rows = std::clamp(rows, 1, MAX_SIDE);
+        columns = std::clamp(columns, 1, MAX_SIDE);
+        return Options{rows, columns, std::clamp(mines, 0, rows * columns - 1)};
+    }
+
+    // whether getOptions would take the dimensions as they are
+    [[nodiscard]] bool Options::isValid(int rows, int columns, int mines) {
+        return rows >= 1 && rows <= MAX_SIDE && columns >= 1 && columns <= MAX_SIDE && mines >= 0 &&
+               mines < rows * columns;
+    }
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #ifndef MINESWEEPER_OPTIONS_H
 #define MINESWEEPER_OPTIONS_H
 
-#include <functional>
-#import "Mode.h"
+#include <algorithm>
+#include "Mode.h"
 
 namespace minesweeper {
     class Options {
@@ -13,13 +13,80 @@ namespace minesweeper {
         [[nodiscard]] int getBlanks() const;
         [[nodiscard]] int getRows() const;
         [[nodiscard]] int getColumns() const;
-        void forEachNeighbor(int row, int col, const std::function<void(int, int)> &fn) const;
+        template<typename Fn>
+        void forEachNeighbor(int row, int col, Fn &&fn) const;
+        template<typename Fn>
+        void forEachNeighbor(int n, Fn &&fn) const;
         static Options getOptions(Mode::Enum mode);
+        static Options getOptions(int rows, int columns, int mines);
+        [[nodiscard]] static bool isValid(int rows, int columns, int mines);
     private:
+        static constexpr int MAX_SIDE = 10000;
+        static constexpr int NEIGHBORS = 8;
         const int rows;
         const int columns;
         const int mines;
+        int offsets[NEIGHBORS];
+        [[nodiscard]] bool isInterior(int row, int col) const;
     };
+
+    // the accessors are inline, as board-wide loops query them per cell
+    [[nodiscard]] inline int Options::getTiles() const {
+        return rows * columns;
+    }
+
+    [[nodiscard]] inline int Options::getMines() const {
+        return mines;
+    }
+
+    [[nodiscard]] inline int Options::getBlanks() const {
+        return getTiles() - mines;
+    }
+
+    [[nodiscard]] inline int Options::getRows() const {
+        return rows;
+    }
+
+    [[nodiscard]] inline int Options::getColumns() const {
+        return columns;
+    }
+
+    [[nodiscard]] inline bool Options::isInterior(int row, int col) const {
+        return row > 0 && row < rows - 1 && col > 0 && col < columns - 1;
+    }
+
+    // interior cells, the vast majority on any large board, skip the bounds checks entirely
+    template<typename Fn>
+    void Options::forEachNeighbor(int row, int col, Fn &&fn) const {
+        if (isInterior(row, col)) {
+            fn(row - 1, col - 1);
+            fn(row - 1, col);
+            fn(row - 1, col + 1);
+            fn(row, col - 1);
+            fn(row, col + 1);
+            fn(row + 1, col - 1);
+            fn(row + 1, col);
+            fn(row + 1, col + 1);
+            return;
+        }
+        for (int r = std::max(row - 1, 0); r <= std::min(row + 1, rows - 1); r++)
+            for (int c = std::max(col - 1, 0); c <= std::min(col + 1, columns - 1); c++)
+                if (r != row || c != col)
+                    fn(r, c);
+    }
+
+    // the same neighbors by cell index, offset by the deltas computed once for this board width
+    template<typename Fn>
+    void Options::forEachNeighbor(int n, Fn &&fn) const {
+        int row = n / columns;
+        int col = n % columns;
+        if (isInterior(row, col)) {
+            for (int offset : offsets)
+                fn(n + offset);
+            return;
+        }
+        forEachNeighbor(row, col, [&fn, this](int r, int c) { fn(r * columns + c); });
+    }
 };
 
 #endif
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include "AdjacencyKernel.h"
+#include "../util/Bits.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace minesweeper {
+    AdjacencyKernel::AdjacencyKernel(int rows, int columns) :
+            rows(rows),
+            columns(columns),
+            width(columns + 2),
+            plane((rows + 2) * width),
+            sums(width) {
+
+    }
+
+    void AdjacencyKernel::compute(const uint64_t *mines, int wordsPerRow, uint8_t *counts) {
+        unpack(mines, wordsPerRow);
+        for (int r = 0; r < rows; r++) {
+            const uint8_t *row = &plane[(r + 1) * width];
+            sumColumns(row - width, row, row + width);
+            sumRows(row, counts + r * columns);
+        }
+    }
+
+    // one byte per cell with a zero border, so every cell has eight neighbors
+    void AdjacencyKernel::unpack(const uint64_t *mines, int wordsPerRow) {
+        std::fill(plane.begin(), plane.end(), 0);
+        for (int r = 0; r < rows; r++) {
+            uint8_t *row = &plane[(r + 1) * width + 1];
+            for (int w = 0; w < wordsPerRow; w++) {
+                for (uint64_t word = mines[r * wordsPerRow + w]; word != 0; word &= word - 1) {
+                    row[w * 64 + countTrailingZeros(word)] = 1;
+                }
+            }
+        }
+    }
+
+    void AdjacencyKernel::sumColumns(const uint8_t *above, const uint8_t *row, const uint8_t *below) {
+        int c = 0;
+#if defined(__AVX2__)
+        for (; c + 32 <= width; c += 32) {
+            auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above + c));
+            auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + c));
+            auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below + c));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(&sums[c]), _mm256_add_epi8(_mm256_add_epi8(a, b), d));
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        for (; c + 16 <= width; c += 16) {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(above + c));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + c));
+            auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(below + c));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&sums[c]), _mm_add_epi8(_mm_add_epi8(a, b), d));
+        }
+#endif
+        for (; c < width; c++) {
+            sums[c] = above[c] + row[c] + below[c];
+        }
+    }
+
+    // box sum of the three column sums, less the center cell itself
+    void AdjacencyKernel::sumRows(const uint8_t *row, uint8_t *out) {
+        const uint8_t *s = sums.data();
+        int c = 0;
+#if defined(__AVX2__)
+        for (; c + 32 <= columns; c += 32) {
+            auto l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + c));
+            auto m = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + c + 1));
+            auto r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + c + 2));
+            auto self = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + c + 1));
+            auto box = _mm256_add_epi8(_mm256_add_epi8(l, m), r);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + c), _mm256_sub_epi8(box, self));
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        for (; c + 16 <= columns; c += 16) {
+            auto l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + c));
+            auto m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + c + 1));
+            auto r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + c + 2));
+            auto self = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + c + 1));
+            auto box = _mm_add_epi8(_mm_add_epi8(l, m), r);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + c), _mm_sub_epi8(box, self));
+        }
+#endif
+        for (; c < columns; c++) {
+            out[c] = s[c] + s[c + 1] + s[c + 2] - row[c + 1];
+        }
+    }
+}
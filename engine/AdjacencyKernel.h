@@ -0,0 +1,24 @@
+#ifndef MINESWEEPER_ADJACENCYKERNEL_H
+#define MINESWEEPER_ADJACENCYKERNEL_H
+
+#include <cstdint>
+#include <vector>
+
+namespace minesweeper {
+    class AdjacencyKernel {
+    public:
+        AdjacencyKernel(int rows, int columns);
+        void compute(const uint64_t *mines, int wordsPerRow, uint8_t *counts);
+    private:
+        const int rows;
+        const int columns;
+        const int width;
+        std::vector<uint8_t> plane;
+        std::vector<uint8_t> sums;
+        void unpack(const uint64_t *mines, int wordsPerRow);
+        void sumColumns(const uint8_t *above, const uint8_t *row, const uint8_t *below);
+        void sumRows(const uint8_t *row, uint8_t *out);
+    };
+};
+
+#endif
@@ -0,0 +1,283 @@
+#include <algorithm>
+#include "Board.h"
+#include "Generator.h"
+#include "Dealer.h"
+
+namespace minesweeper {
+    Board::Board(const Options &options, uint64_t seed) :
+            options(options),
+            seed(seed),
+            layout(seed),
+            mineField(std::make_unique<MineField>(options, seed)),
+            cells{options.getRows(), options.getColumns()},
+            adjacentFlags{options.getRows(), options.getColumns()},
+            state(GameState::INIT),
+            revealed(0),
+            flags(options.getMines()),
+            generation(0),
+            generator(nullptr),
+            dealer(nullptr),
+            recorder(nullptr) {
+        layMines();
+    }
+
+    void Board::setGenerator(Generator *g) {
+        generator = g;
+    }
+
+    void Board::setDealer(Dealer *d) {
+        dealer = d;
+    }
+
+    void Board::setRecorder(Recorder *r) {
+        recorder = r;
+    }
+
+    void Board::reset() {
+        reset(Random::nextSeed(seed));
+    }
+
+    void Board::reset(uint64_t gameSeed) {
+        std::unique_ptr<Board> next = dealer != nullptr ? dealer->take(gameSeed) : nullptr;
+        if (next) {
+            adopt(*next);
+        } else {
+            int row = options.getRows() / 2;
+            int col = options.getColumns() / 2;
+            uint64_t solved = gameSeed;
+            bool solvable = generator != nullptr && generator->generate(gameSeed, row, col, solved);
+            restart(solved);
+            seed = gameSeed;
+            if (solvable)
+                start(row, col);
+        }
+        setState(GameState::INIT);
+        onDealt(generator != nullptr);
+    }
+
+    // lays out the given mine field with the start cell already open, still waiting for the first move
+    void Board::reset(uint64_t layout, int row, int col) {
+        restart(layout);
+        seed = layout;
+        start(row, col);
+        setState(GameState::INIT);
+    }
+
+    // deals a recorded game as it was laid out, without asking the generator or the dealer again
+    void Board::deal(uint64_t gameSeed, uint64_t layout, bool noGuess, bool opened) {
+        restart(layout);
+        seed = gameSeed;
+        if (opened)
+            start(options.getRows() / 2, options.getColumns() / 2);
+        setState(GameState::INIT);
+        onDealt(noGuess);
+    }
+
+    void Board::reveal(int row, int col) {
+        if (recorder != nullptr)
+            recorder->onMove(Recorder::REVEAL, row, col);
+        uint8_t &cell = cells.at(row, col);
+        if (!isHidden(cell))
+            return;
+        if (state == GameState::INIT && revealed == 0 && (isMine(row, col) || getAdjacentMines(row, col) > 0))
+            relayMines(row, col);
+        if (isMine(row, col)) {
+            cell |= REVEALED;
+            changes.push_back(row * options.getColumns() + col);
+            setState(GameState::LOST);
+            return;
+        }
+        onRevealed(open(row, col));
+    }
+
+    void Board::toggleFlag(int row, int col) {
+        if (recorder != nullptr)
+            recorder->onMove(Recorder::FLAG, row, col);
+        uint8_t &cell = cells.at(row, col);
+        if (isGameOver() || (cell & REVEALED))
+            return;
+        if (!(cell & FLAGGED) && flags == 0)
+            return;
+        cell ^= FLAGGED;
+        int delta = (cell & FLAGGED) ? 1 : -1;
+        flags -= delta;
+        int opening = openings.getOpening(row * options.getColumns() + col);
+        if (opening >= 0)
+            openings.disturb(opening);
+        changes.push_back(row * options.getColumns() + col);
+        options.forEachNeighbor(row, col, [delta, this](int r, int c) { adjacentFlags.at(r, c) += delta; });
+    }
+
+    void Board::clear(int row, int col) {
+        if (recorder != nullptr)
+            recorder->onMove(Recorder::CHORD, row, col);
+        if (isGameOver() || !(cells.at(row, col) & REVEALED))
+            return;
+        if (adjacentFlags.at(row, col) != getAdjacentMines(row, col))
+            return;
+        int count = 0;
+        int mine = -1;
+        options.forEachNeighbor(row, col, [&count, &mine, this](int r, int c) {
+            if (mine >= 0 || !isHidden(cells.at(r, c)))
+                return;
+            if (isMine(r, c))
+                mine = r * options.getColumns() + c;
+            else
+                count += open(r, c);
+        });
+        if (count > 0)
+            onRevealed(count);
+        if (mine >= 0 && !isGameOver()) {
+            int columns = options.getColumns();
+            cells.at(mine / columns, mine % columns) |= REVEALED;
+            changes.push_back(mine);
+            setState(GameState::LOST);
+        }
+    }
+
+    [[nodiscard]] uint64_t Board::getSeed() const {
+        return seed;
+    }
+
+    [[nodiscard]] GameState Board::getState() const {
+        return state;
+    }
+
+    [[nodiscard]] int Board::getFlags() const {
+        return flags;
+    }
+
+    [[nodiscard]] int Board::getGeneration() const {
+        return generation;
+    }
+
+    [[nodiscard]] const std::vector<int> &Board::getChanges() const {
+        return changes;
+    }
+
+    // 3BV, the fewest clicks that clear the board
+    [[nodiscard]] int Board::getClicks() const {
+        return openings.getClicks();
+    }
+
+    [[nodiscard]] bool Board::isGameOver() const {
+        return state == GameState::WON || state == GameState::LOST;
+    }
+
+    [[nodiscard]] bool Board::isHidden(uint8_t cell) const {
+        return !isGameOver() && !(cell & (FLAGGED | REVEALED));
+    }
+
+    int Board::open(int row, int col) {
+        int columns = options.getColumns();
+        int count = 0;
+        auto visit = [&count, columns, this](int r, int c) {
+            uint8_t &cell = cells.at(r, c);
+            if (cell & (FLAGGED | REVEALED))
+                return;
+            int opening = openings.getOpening(r * columns + c);
+            if (opening >= 0 && openings.isIntact(opening)) {
+                count += openAll(opening);
+                return;
+            }
+            cell |= REVEALED;
+            changes.push_back(r * columns + c);
+            count++;
+            if (opening >= 0) {
+                openings.disturb(opening);
+                pending.push_back(r * columns + c);
+            }
+        };
+        visit(row, col);
+        while (!pending.empty()) {
+            int n = pending.back();
+            pending.pop_back();
+            options.forEachNeighbor(n / columns, n % columns, visit);
+        }
+        return count;
+    }
+
+    // an opening none of whose zero cells has been touched is uncovered whole, as the flood would have done
+    int Board::openAll(int opening) {
+        int count = 0;
+        uint8_t *marks = cells.data();
+        for (const int *n = openings.begin(opening); n != openings.end(opening); n++) {
+            if (marks[*n] & (FLAGGED | REVEALED))
+                continue;
+            marks[*n] |= REVEALED;
+            changes.push_back(*n);
+            count++;
+        }
+        openings.disturb(opening);
+        return count;
+    }
+
+    void Board::onRevealed(int count) {
+        if (state == GameState::INIT)
+            setState(GameState::PLAYING);
+        revealed += count;
+        if (revealed == options.getBlanks())
+            setState(GameState::WON);
+    }
+
+    void Board::restart(uint64_t layout) {
+        this->layout = layout;
+        mineField->reset(layout);
+        layMines();
+        revealed = 0;
+        flags = options.getMines();
+        generation++;
+        changes.clear();
+    }
+
+    // takes over a board prepared in the background, keeping this board's hooks and generation count
+    void Board::adopt(Board &next) {
+        std::swap(seed, next.seed);
+        std::swap(layout, next.layout);
+        std::swap(mineField, next.mineField);
+        std::swap(openings, next.openings);
+        std::swap(cells, next.cells);
+        std::swap(adjacentFlags, next.adjacentFlags);
+        std::swap(changes, next.changes);
+        revealed = next.revealed;
+        flags = next.flags;
+        generation++;
+    }
+
+    void Board::start(int row, int col) {
+        if (isMine(row, col) || getAdjacentMines(row, col) > 0)
+            relayMines(row, col);
+        revealed += open(row, col);
+    }
+
+    // mines and counts stay in the mine field; only the player's marks live in the board's planes
+    void Board::layMines() {
+        std::fill_n(cells.data(), cells.size(), 0);
+        std::fill_n(adjacentFlags.data(), adjacentFlags.size(), 0);
+        openings.build(*mineField, options);
+    }
+
+    // moves mines out of the first clicked zone, keeping any flags placed before the first reveal
+    void Board::relayMines(int row, int col) {
+        mineField->reset(row, col);
+        openings.build(*mineField, options);
+        const uint8_t *marks = cells.data();
+        for (int n = 0; n < cells.size(); n++) {
+            int opening = openings.getOpening(n);
+            if ((marks[n] & FLAGGED) && opening >= 0)
+                openings.disturb(opening);
+        }
+    }
+
+    void Board::setState(GameState gs) {
+        state = gs;
+        if (recorder != nullptr && isGameOver())
+            recorder->onEnd(state);
+    }
+
+    // a deal is logged with the layout it settled on, so replaying it never depends on the generator
+    void Board::onDealt(bool noGuess) {
+        if (recorder != nullptr)
+            recorder->onDeal(options, seed, noGuess, layout, revealed > 0);
+    }
+}
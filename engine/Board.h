@@ -0,0 +1,94 @@
+#ifndef MINESWEEPER_BOARD_H
+#define MINESWEEPER_BOARD_H
+
+#include <memory>
+#include <vector>
+#include "../config/Options.h"
+#include "../util/Matrix.h"
+#include "GameState.h"
+#include "MineField.h"
+#include "Openings.h"
+#include "Recorder.h"
+
+namespace minesweeper {
+    class Generator;
+    class Dealer;
+
+    class Board {
+    public:
+        Board(const Options &options, uint64_t seed);
+        void setGenerator(Generator *g);
+        void setDealer(Dealer *d);
+        void setRecorder(Recorder *r);
+        void reset();
+        void reset(uint64_t gameSeed);
+        void reset(uint64_t layout, int row, int col);
+        void deal(uint64_t gameSeed, uint64_t layout, bool noGuess, bool opened);
+        void reveal(int row, int col);
+        void toggleFlag(int row, int col);
+        void clear(int row, int col);
+        [[nodiscard]] uint64_t getSeed() const;
+        [[nodiscard]] GameState getState() const;
+        [[nodiscard]] int getFlags() const;
+        [[nodiscard]] bool isRevealed(int row, int col) const;
+        [[nodiscard]] bool isFlagged(int row, int col) const;
+        [[nodiscard]] bool isMine(int row, int col) const;
+        [[nodiscard]] int getAdjacentMines(int row, int col) const;
+        [[nodiscard]] int getGeneration() const;
+        [[nodiscard]] const std::vector<int> &getChanges() const;
+        [[nodiscard]] int getClicks() const;
+    private:
+        enum Cell : uint8_t {
+            FLAGGED = 1,
+            REVEALED = 2
+        };
+
+        const Options &options;
+        uint64_t seed;
+        uint64_t layout;
+        std::unique_ptr<MineField> mineField;
+        Openings openings;
+        Matrix<uint8_t> cells;
+        Matrix<uint8_t> adjacentFlags;
+        GameState state;
+        int revealed;
+        int flags;
+        int generation;
+        std::vector<int> changes;
+        Generator *generator;
+        Dealer *dealer;
+        Recorder *recorder;
+        std::vector<int> pending;
+        [[nodiscard]] bool isGameOver() const;
+        [[nodiscard]] bool isHidden(uint8_t cell) const;
+        int open(int row, int col);
+        int openAll(int opening);
+        void onRevealed(int count);
+        void restart(uint64_t layout);
+        void adopt(Board &next);
+        void start(int row, int col);
+        void layMines();
+        void relayMines(int row, int col);
+        void setState(GameState gs);
+        void onDealt(bool noGuess);
+    };
+
+    // inline, as the solvers query single cells in their innermost loops
+    [[nodiscard]] inline bool Board::isRevealed(int row, int col) const {
+        return cells.at(row, col) & REVEALED;
+    }
+
+    [[nodiscard]] inline bool Board::isFlagged(int row, int col) const {
+        return cells.at(row, col) & FLAGGED;
+    }
+
+    [[nodiscard]] inline bool Board::isMine(int row, int col) const {
+        return mineField->mineAt(row, col);
+    }
+
+    [[nodiscard]] inline int Board::getAdjacentMines(int row, int col) const {
+        return mineField->adjacentMines(row, col);
+    }
+};
+
+#endif
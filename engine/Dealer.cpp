@@ -0,0 +1,93 @@
+#include "../util/Random.h"
+#include "Dealer.h"
+#include "Board.h"
+
+namespace minesweeper {
+    // with a pool, boards are dealt no-guess by a generator of the dealer's own, so cancelling its searches
+    // never touches one the caller runs
+    Dealer::Dealer(const Options &options, ThreadPool *pool) :
+            options(options),
+            generator(pool != nullptr ? std::make_unique<Generator>(options, *pool) : nullptr),
+            upcoming(0),
+            preparing(0),
+            epoch(0),
+            dealing(false),
+            busy(false),
+            stopping(false),
+            worker(&Dealer::work, this) {
+
+    }
+
+    Dealer::~Dealer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            if (generator)
+                generator->setCancelled(true);
+        }
+        changed.notify_all();
+        worker.join();
+    }
+
+    // starts preparing the games that follow the one played with the given seed
+    void Dealer::deal(uint64_t seed) {
+        std::lock_guard<std::mutex> lock(mutex);
+        restart(Random::nextSeed(seed));
+    }
+
+    // hands over the prepared board for the seed, waiting if it is being prepared right now; any other seed
+    // restarts the sequence from it, so the board is still built here, and only once
+    std::unique_ptr<Board> Dealer::take(uint64_t seed) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [seed, this] { return !boards.empty() || !busy || preparing != seed; });
+        if (boards.empty() || boards.front()->getSeed() != seed) {
+            restart(seed);
+            changed.wait(lock, [this] { return !boards.empty(); });
+        }
+        std::unique_ptr<Board> board{std::move(boards.front())};
+        boards.pop_front();
+        changed.notify_all();
+        return board;
+    }
+
+    // drops what was prepared and stops the board in progress, whose seed is no longer wanted
+    void Dealer::restart(uint64_t seed) {
+        boards.clear();
+        upcoming = seed;
+        epoch++;
+        dealing = true;
+        if (generator)
+            generator->setCancelled(true);
+        changed.notify_all();
+    }
+
+    void Dealer::work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            changed.wait(lock, [this] { return stopping || (dealing && boards.size() < DEPTH); });
+            if (stopping)
+                return;
+            uint64_t seed = upcoming;
+            int ticket = epoch;
+            preparing = seed;
+            busy = true;
+            if (generator)
+                generator->setCancelled(false);
+            lock.unlock();
+
+            auto board = std::make_unique<Board>(options, seed);
+            if (generator) {
+                board->setGenerator(generator.get());
+                board->reset(seed);
+            }
+
+            lock.lock();
+            busy = false;
+            if (ticket == epoch) {
+                boards.push_back(std::move(board));
+                upcoming = Random::nextSeed(seed);
+            }
+            changed.notify_all();
+        }
+    }
+}
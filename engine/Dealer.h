@@ -0,0 +1,43 @@
+#ifndef MINESWEEPER_DEALER_H
+#define MINESWEEPER_DEALER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "../config/Options.h"
+#include "Generator.h"
+
+namespace minesweeper {
+    class Board;
+
+    class Dealer {
+    public:
+        Dealer(const Options &options, ThreadPool *pool);
+        Dealer(const Dealer &) = delete;
+        Dealer &operator=(const Dealer &) = delete;
+        ~Dealer();
+        void deal(uint64_t seed);
+        std::unique_ptr<Board> take(uint64_t seed);
+    private:
+        static constexpr size_t DEPTH = 2;
+        const Options &options;
+        std::unique_ptr<Generator> generator;
+        std::deque<std::unique_ptr<Board>> boards;
+        uint64_t upcoming;
+        uint64_t preparing;
+        int epoch;
+        bool dealing;
+        bool busy;
+        bool stopping;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::thread worker;
+        void restart(uint64_t seed);
+        void work();
+    };
+};
+
+#endif
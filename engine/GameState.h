@@ -0,0 +1,13 @@
+#ifndef MINESWEEPER_GAMESTATE_H
+#define MINESWEEPER_GAMESTATE_H
+
+namespace minesweeper {
+    enum class GameState {
+        INIT,
+        PLAYING,
+        WON,
+        LOST
+    };
+};
+
+#endif
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <atomic>
+#include "../util/Random.h"
+#include "Generator.h"
+#include "Board.h"
+#include "Solver.h"
+
+namespace minesweeper {
+    Generator::Generator(const Options &options, ThreadPool &pool) :
+            options(options),
+            pool(pool),
+            attempts(std::clamp(BUDGET / options.getTiles(), MIN_ATTEMPTS, MAX_ATTEMPTS)),
+            cancelled(false) {
+
+    }
+
+    // searches for a layout that the solver clears from the given start cell without guessing; attempts run
+    // concurrently but the lowest successful attempt wins, so the result depends on the seed alone; once the
+    // budget is spent, or once cancelled, it gives up and the caller deals a plain board instead
+    bool Generator::generate(uint64_t seed, int row, int col, uint64_t &layout) {
+        std::atomic<int> next{0};
+        std::atomic<int> found{attempts};
+        ThreadPool::Group group;
+        for (int i = 0; i < pool.getThreads(); i++) {
+            pool.submit(group, [&next, &found, seed, row, col, this] {
+                Board board{options, seed};
+                Solver solver{board, options};
+                for (int attempt = next++; attempt < found && !cancelled; attempt = next++) {
+                    board.reset(getAttemptSeed(seed, attempt), row, col);
+                    solver.update();
+                    int r, c;
+                    while (board.getState() != GameState::WON) {
+                        if (solver.nextSafe(r, c))
+                            board.reveal(r, c);
+                        else if (solver.nextMine(r, c))
+                            board.toggleFlag(r, c);
+                        else
+                            break;
+                        solver.update();
+                    }
+                    if (board.getState() == GameState::WON) {
+                        int current = found;
+                        while (attempt < current && !found.compare_exchange_weak(current, attempt)) {}
+                        return;
+                    }
+                }
+            });
+        }
+        pool.wait(group);
+        // a cancelled search may have skipped a lower attempt that would have won, so its result is dropped
+        if (found == attempts || cancelled)
+            return false;
+        layout = getAttemptSeed(seed, found);
+        return true;
+    }
+
+    // checked between attempts, so a search nobody waits for any more stops early
+    void Generator::setCancelled(bool c) {
+        cancelled = c;
+    }
+
+    uint64_t Generator::getAttemptSeed(uint64_t seed, int attempt) {
+        return Random::nextSeed(seed + static_cast<uint64_t>(attempt) * 0x9e3779b97f4a7c15);
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef MINESWEEPER_GENERATOR_H
+#define MINESWEEPER_GENERATOR_H
+
+#include <atomic>
+#include <cstdint>
+#include "../config/Options.h"
+#include "../util/ThreadPool.h"
+
+namespace minesweeper {
+    class Generator {
+    public:
+        Generator(const Options &options, ThreadPool &pool);
+        bool generate(uint64_t seed, int row, int col, uint64_t &layout);
+        void setCancelled(bool c);
+        static uint64_t getAttemptSeed(uint64_t seed, int attempt);
+    private:
+        // attempts cost about one step per tile, so the budget is a number of tiles rather than of attempts
+        static constexpr int BUDGET = 1 << 22;
+        static constexpr int MIN_ATTEMPTS = 16;
+        static constexpr int MAX_ATTEMPTS = 1 << 16;
+        const Options &options;
+        ThreadPool &pool;
+        const int attempts;
+        std::atomic<bool> cancelled;
+    };
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <numeric>
+#include "MineField.h"
+
+namespace minesweeper {
+    MineField::MineField(const Options &options, uint64_t seed) :
+            random(seed),
+            options(options),
+            wordsPerRow((options.getColumns() + WORD_BITS - 1) / WORD_BITS),
+            mines(options.getRows() * wordsPerRow),
+            counts(options.getTiles()),
+            cells(options.getTiles()),
+            positions(options.getTiles()),
+            kernel(options.getRows(), options.getColumns()) {
+        std::iota(cells.begin(), cells.end(), 0);
+        std::iota(positions.begin(), positions.end(), 0);
+        place(nullptr, 0);
+    }
+
+    void MineField::reset(uint64_t seed) {
+        random = Random{seed};
+        place(nullptr, 0);
+    }
+
+    // keeps the 3x3 zone around the cell free of mines, or just the cell itself on boards too dense for the zone
+    void MineField::reset(int row, int col) {
+        int zone[9];
+        int count = 0;
+        for (int r = std::max(row - 1, 0); r <= std::min(row + 1, options.getRows() - 1); r++)
+            for (int c = std::max(col - 1, 0); c <= std::min(col + 1, options.getColumns() - 1); c++)
+                zone[count++] = r * options.getColumns() + c;
+        if (count > options.getBlanks()) {
+            zone[0] = row * options.getColumns() + col;
+            count = options.getBlanks() > 0 ? 1 : 0;
+        }
+        place(zone, count);
+    }
+
+    // partial Fisher-Yates shuffle over the cell permutation, drawing whichever of the mines
+    // or the blanks is the smaller set, so the cost is independent of density
+    void MineField::place(const int *excluded, int count) {
+        restore();
+        int tiles = options.getTiles();
+        for (int i = 0; i < count; i++)
+            swap(positions[excluded[i]], tiles - 1 - i);
+
+        int available = tiles - count;
+        bool inverted = options.getMines() > available / 2;
+        int picks = inverted ? available - options.getMines() : options.getMines();
+        for (int i = 0; i < picks; i++)
+            swap(i, random.randomInt(i, available - 1));
+
+        if (inverted) {
+            int columns = options.getColumns();
+            uint64_t last = columns % WORD_BITS == 0 ? ~uint64_t{0} : (uint64_t{1} << (columns % WORD_BITS)) - 1;
+            for (size_t w = 0; w < mines.size(); w++)
+                mines[w] = (w + 1) % wordsPerRow == 0 ? last : ~uint64_t{0};
+            for (int i = 0; i < picks; i++)
+                set(cells[i], false);
+            for (int i = 0; i < count; i++)
+                set(excluded[i], false);
+        } else {
+            std::fill(mines.begin(), mines.end(), 0);
+            for (int i = 0; i < picks; i++)
+                set(cells[i], true);
+        }
+        kernel.compute(mines.data(), wordsPerRow, counts.data());
+    }
+
+    void MineField::swap(int i, int j) {
+        std::swap(cells[i], cells[j]);
+        positions[cells[i]] = i;
+        positions[cells[j]] = j;
+        swaps.push_back(i);
+        swaps.push_back(j);
+    }
+
+    // undoes the previous placement's swaps, so every placement starts from the identity permutation
+    // and a seed alone determines the board
+    void MineField::restore() {
+        for (size_t k = swaps.size(); k > 0; k -= 2) {
+            int i = swaps[k - 2];
+            int j = swaps[k - 1];
+            std::swap(cells[i], cells[j]);
+            positions[cells[i]] = i;
+            positions[cells[j]] = j;
+        }
+        swaps.clear();
+    }
+
+    void MineField::set(int n, bool mine) {
+        int columns = options.getColumns();
+        uint64_t &word = mines[(n / columns) * wordsPerRow + (n % columns) / WORD_BITS];
+        uint64_t bit = uint64_t{1} << (n % columns % WORD_BITS);
+        word = mine ? word | bit : word & ~bit;
+    }
+}
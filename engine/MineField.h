@@ -0,0 +1,45 @@
+#ifndef MINESWEEPER_MINEFIELD_H
+#define MINESWEEPER_MINEFIELD_H
+
+#include <cstdint>
+#include <vector>
+#include "../util/Random.h"
+#include "../config/Options.h"
+#include "AdjacencyKernel.h"
+
+namespace minesweeper {
+    class MineField {
+    public:
+        MineField(const Options &options, uint64_t seed);
+        void reset(uint64_t seed);
+        void reset(int row, int col);
+        [[nodiscard]] bool mineAt(int row, int col) const;
+        [[nodiscard]] int adjacentMines(int row, int col) const;
+    private:
+        static constexpr int WORD_BITS = 64;
+        Random random;
+        const Options &options;
+        const int wordsPerRow;
+        std::vector<uint64_t> mines;
+        std::vector<uint8_t> counts;
+        std::vector<int> cells;
+        std::vector<int> positions;
+        std::vector<int> swaps;
+        AdjacencyKernel kernel;
+        void place(const int *excluded, int count);
+        void swap(int i, int j);
+        void restore();
+        void set(int n, bool mine);
+    };
+
+    // inline, as the board reads mines and counts from here on every move
+    [[nodiscard]] inline bool MineField::mineAt(int row, int col) const {
+        return (mines[row * wordsPerRow + col / WORD_BITS] >> (col % WORD_BITS)) & 1;
+    }
+
+    [[nodiscard]] inline int MineField::adjacentMines(int row, int col) const {
+        return counts[row * options.getColumns() + col];
+    }
+};
+
+#endif
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include "Openings.h"
+
+namespace minesweeper {
+    // labels runs of zero cells row by row, joining runs that touch across rows with union-find, then lists every
+    // opening's zero cells followed by its border; sparse boards cost about one step per run instead of per cell
+    void Openings::build(const MineField &mineField, const Options &options) {
+        int rows = options.getRows();
+        int columns = options.getColumns();
+        int tiles = options.getTiles();
+        kinds.resize(tiles);
+        int numbers = 0;
+        for (int r = 0, n = 0; r < rows; r++) {
+            for (int c = 0; c < columns; c++, n++) {
+                kinds[n] = mineField.mineAt(r, c) ? MINE : mineField.adjacentMines(r, c) == 0 ? ZERO : NUMBER;
+                numbers += kinds[n] == NUMBER;
+            }
+        }
+
+        runs.clear();
+        int previous = 0;
+        for (int r = 0; r < rows; r++) {
+            int current = static_cast<int>(runs.size());
+            int above = previous;
+            const uint8_t *row = &kinds[r * columns];
+            for (int c = 0; c < columns; c++) {
+                if (row[c] != ZERO)
+                    continue;
+                int begin = r * columns + c;
+                while (c < columns && row[c] == ZERO)
+                    c++;
+                int run = static_cast<int>(runs.size());
+                runs.push_back({begin, r * columns + c, run});
+                // runs of the row above overlapping this one, corners included, are the same opening
+                while (above < current && runs[above].end + columns < begin)
+                    above++;
+                for (int i = above; i < current && runs[i].begin + columns <= runs[run].end; i++)
+                    unite(i, run);
+            }
+            previous = current;
+        }
+
+        // openings are numbered in reading order of their first cell; a parent always precedes its children,
+        // so it is labeled by the time they are reached
+        int openings = 0;
+        labels.assign(tiles, -1);
+        for (size_t i = 0; i < runs.size(); i++) {
+            if (runs[i].opening == static_cast<int>(i))
+                runs[i].opening = openings++;
+            else
+                runs[i].opening = runs[runs[i].opening].opening;
+            std::fill(labels.begin() + runs[i].begin, labels.begin() + runs[i].end, runs[i].opening);
+        }
+
+        // the border of a run is every numbered cell in the box around it; runs of one opening share border
+        // cells, so the candidates are grouped by opening and each cell is kept once per group, a numbered
+        // cell's label holding -2 - the last opening that kept it
+        candidates.clear();
+        for (const Run &run : runs) {
+            int r = run.begin / columns;
+            int first = std::max(run.begin - r * columns - 1, 0);
+            int last = std::min(run.end - r * columns, columns - 1);
+            for (int row = r - 1; row <= r + 1; row += 2)
+                if (row >= 0 && row < rows)
+                    for (int n = row * columns + first; n <= row * columns + last; n++)
+                        if (kinds[n] == NUMBER)
+                            candidates.emplace_back(run.opening, n);
+            if (kinds[r * columns + first] == NUMBER)
+                candidates.emplace_back(run.opening, r * columns + first);
+            if (kinds[r * columns + last] == NUMBER)
+                candidates.emplace_back(run.opening, r * columns + last);
+        }
+        std::vector<int> sizes(openings + 1, 0);
+        for (const auto &candidate : candidates)
+            sizes[candidate.first + 1]++;
+        for (int i = 0; i < openings; i++)
+            sizes[i + 1] += sizes[i];
+        borders.resize(candidates.size());
+        for (const auto &candidate : candidates)
+            borders[sizes[candidate.first]++] = candidate;
+
+        std::fill(sizes.begin(), sizes.end(), 0);
+        size_t kept = 0;
+        int covered = 0;
+        for (const auto &[opening, n] : borders) {
+            if (labels[n] == -2 - opening)
+                continue;
+            covered += labels[n] == -1;
+            labels[n] = -2 - opening;
+            borders[kept++] = {opening, n};
+            sizes[opening]++;
+        }
+        borders.resize(kept);
+        for (const Run &run : runs)
+            sizes[run.opening] += run.end - run.begin;
+
+        starts.assign(openings + 1, 0);
+        for (int i = 0; i < openings; i++)
+            starts[i + 1] = starts[i] + sizes[i];
+        members.resize(starts[openings]);
+        std::copy(starts.begin(), starts.end() - 1, sizes.begin());
+        for (const Run &run : runs)
+            for (int n = run.begin; n < run.end; n++)
+                members[sizes[run.opening]++] = n;
+        for (const auto &[opening, n] : borders)
+            members[sizes[opening]++] = n;
+        intact.assign(openings, 1);
+
+        // 3BV: one click per opening plus one per number outside every opening
+        clicks = openings + numbers - covered;
+    }
+
+    [[nodiscard]] const int *Openings::begin(int opening) const {
+        return members.data() + starts[opening];
+    }
+
+    [[nodiscard]] const int *Openings::end(int opening) const {
+        return members.data() + starts[opening + 1];
+    }
+
+    // true until one of its zero cells is flagged or revealed on its own
+    [[nodiscard]] bool Openings::isIntact(int opening) const {
+        return intact[opening];
+    }
+
+    void Openings::disturb(int opening) {
+        intact[opening] = 0;
+    }
+
+    [[nodiscard]] int Openings::getClicks() const {
+        return clicks;
+    }
+
+    int Openings::find(int run) {
+        while (runs[run].opening != run) {
+            runs[run].opening = runs[runs[run].opening].opening;
+            run = runs[run].opening;
+        }
+        return run;
+    }
+
+    void Openings::unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a != b)
+            runs[std::max(a, b)].opening = std::min(a, b);
+    }
+}
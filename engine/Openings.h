@@ -0,0 +1,55 @@
+#ifndef MINESWEEPER_OPENINGS_H
+#define MINESWEEPER_OPENINGS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../config/Options.h"
+#include "MineField.h"
+
+namespace minesweeper {
+    // the openings of a mine field: each maximal connected region of zero cells together with the numbered
+    // cells bordering it, which is exactly what revealing any one of its zero cells uncovers
+    class Openings {
+    public:
+        void build(const MineField &mineField, const Options &options);
+        [[nodiscard]] int getOpening(int n) const;
+        [[nodiscard]] const int *begin(int opening) const;
+        [[nodiscard]] const int *end(int opening) const;
+        [[nodiscard]] bool isIntact(int opening) const;
+        void disturb(int opening);
+        [[nodiscard]] int getClicks() const;
+    private:
+        enum Kind : uint8_t {
+            NUMBER,
+            ZERO,
+            MINE
+        };
+
+        // cells [begin, end) of one row; opening holds the union-find parent until the runs are labeled
+        struct Run {
+            int begin;
+            int end;
+            int opening;
+        };
+
+        std::vector<uint8_t> kinds;
+        std::vector<Run> runs;
+        std::vector<int> labels;
+        std::vector<std::pair<int, int>> candidates;
+        std::vector<std::pair<int, int>> borders;
+        std::vector<int> starts;
+        std::vector<int> members;
+        std::vector<uint8_t> intact;
+        int clicks = 0;
+        int find(int run);
+        void unite(int a, int b);
+    };
+
+    // the opening of a zero cell, or -1 for any other cell
+    [[nodiscard]] inline int Openings::getOpening(int n) const {
+        return labels[n] >= 0 ? labels[n] : -1;
+    }
+};
+
+#endif
@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cmath>
+#include "Probability.h"
+
+namespace minesweeper {
+    Probability::Probability(const Board &board, const Options &options, ThreadPool *pool) :
+            board(board),
+            options(options),
+            pool(pool),
+            chances(options.getTiles(), 0.0f),
+            visited(options.getTiles(), 0),
+            indices(options.getTiles(), 0),
+            remaining(0),
+            stamp(0),
+            exact(true) {
+
+    }
+
+    // enumerates each frontier component on the pool, then weighs every combination of component mine counts by
+    // the number of ways to place the remaining mines among the unconstrained cells
+    void Probability::compute() {
+        int columns = options.getColumns();
+        int unknown = 0;
+        remaining = options.getMines();
+        components.clear();
+        exact = true;
+        stamp++;
+        for (int n = 0; n < options.getTiles(); n++) {
+            if (board.isRevealed(n / columns, n % columns)) {
+                chances[n] = 0.0f;
+            } else if (board.isFlagged(n / columns, n % columns)) {
+                chances[n] = 1.0f;
+                remaining--;
+            } else {
+                unknown++;
+            }
+        }
+        for (int n = 0; n < options.getTiles(); n++)
+            if (visited[n] != stamp && board.isRevealed(n / columns, n % columns) &&
+                board.getAdjacentMines(n / columns, n % columns) > 0)
+                gather(n);
+
+        std::sort(components.begin(), components.end(), [](const Component &a, const Component &b) {
+            return a.cells.size() > b.cells.size();
+        });
+        // without a pool, components are enumerated on the calling thread
+        for (auto &component : components) {
+            if (pool != nullptr)
+                pool->submit([&component] { enumerate(component); });
+            else
+                enumerate(component);
+        }
+        if (pool != nullptr)
+            pool->wait();
+
+        // components that could not be enumerated are treated like unconstrained cells
+        auto approximate = std::stable_partition(components.begin(), components.end(), [](const Component &c) {
+            return c.exact;
+        });
+        exact = approximate == components.end();
+        components.erase(approximate, components.end());
+        int interior = unknown;
+        for (auto &component : components)
+            interior -= static_cast<int>(component.cells.size());
+
+        std::vector<double> total = product(0, static_cast<int>(components.size()));
+        binomials.assign(total.size(), 0.0);
+        double maxLog = -HUGE_VAL;
+        for (size_t k = 0; k < total.size(); k++)
+            if (total[k] > 0 && remaining - static_cast<int>(k) >= 0 && remaining - static_cast<int>(k) <= interior)
+                maxLog = std::max(maxLog, logChoose(interior, remaining - static_cast<int>(k)));
+        if (maxLog == -HUGE_VAL) {
+            // the flags contradict the board, so only the overall density is left
+            float density = unknown > 0 ? std::clamp(static_cast<float>(remaining) / unknown, 0.0f, 1.0f) : 0.0f;
+            for (int n = 0; n < options.getTiles(); n++)
+                if (isUnknown(n))
+                    chances[n] = density;
+            exact = false;
+            return;
+        }
+
+        double mines = 0, ways = 0;
+        for (size_t k = 0; k < total.size(); k++) {
+            int left = remaining - static_cast<int>(k);
+            if (left >= 0 && left <= interior)
+                binomials[k] = std::exp(logChoose(interior, left) - maxLog);
+            mines += total[k] * binomials[k] * left;
+            ways += total[k] * binomials[k];
+        }
+        float density = interior > 0 ? static_cast<float>(mines / ways / interior) : 0.0f;
+        for (int n = 0; n < options.getTiles(); n++)
+            if (isUnknown(n))
+                chances[n] = density;
+        distribute(0, static_cast<int>(components.size()), std::vector<double>{1.0});
+    }
+
+    [[nodiscard]] float Probability::getMineChance(int row, int col) const {
+        return chances[row * options.getColumns() + col];
+    }
+
+    [[nodiscard]] bool Probability::isExact() const {
+        return exact;
+    }
+
+    bool Probability::safest(int &row, int &col) const {
+        int best = -1;
+        for (int n = 0; n < options.getTiles(); n++)
+            if (isUnknown(n) && (best < 0 || chances[n] < chances[best]))
+                best = n;
+        if (best < 0)
+            return false;
+        row = best / options.getColumns();
+        col = best % options.getColumns();
+        return true;
+    }
+
+    [[nodiscard]] bool Probability::isUnknown(int n) const {
+        int columns = options.getColumns();
+        return !board.isRevealed(n / columns, n % columns) && !board.isFlagged(n / columns, n % columns);
+    }
+
+    // collects the unknown cells linked to a revealed cell through shared constraints, in breadth-first order
+    void Probability::gather(int start) {
+        int columns = options.getColumns();
+        Component component{};
+        component.exact = true;
+        std::vector<int> queue{start};
+        visited[start] = stamp;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int n = queue[i];
+            if (board.isRevealed(n / columns, n % columns)) {
+                Constraint constraint{};
+                constraint.mines = board.getAdjacentMines(n / columns, n % columns);
+                options.forEachNeighbor(n / columns, n % columns, [&](int r, int c) {
+                    int m = r * columns + c;
+                    if (board.isFlagged(r, c)) {
+                        constraint.mines--;
+                    } else if (!board.isRevealed(r, c)) {
+                        if (visited[m] != stamp) {
+                            visited[m] = stamp;
+                            indices[m] = static_cast<int>(component.cells.size());
+                            component.cells.push_back(m);
+                            queue.push_back(m);
+                        }
+                        constraint.variables[constraint.size++] = indices[m];
+                    }
+                });
+                if (constraint.size > 0 || constraint.mines != 0)
+                    component.constraints.push_back(constraint);
+            } else {
+                options.forEachNeighbor(n / columns, n % columns, [&](int r, int c) {
+                    int m = r * columns + c;
+                    if (visited[m] != stamp && board.isRevealed(r, c) && board.getAdjacentMines(r, c) > 0) {
+                        visited[m] = stamp;
+                        queue.push_back(m);
+                    }
+                });
+            }
+        }
+        if (component.cells.empty())
+            return;
+        if (static_cast<int>(component.cells.size()) > MAX_COMPONENT)
+            component.exact = false;
+        component.links.assign(component.cells.size() * LINKS, -1);
+        for (size_t i = 0; i < component.constraints.size(); i++) {
+            const Constraint &constraint = component.constraints[i];
+            for (int j = 0; j < constraint.size; j++) {
+                int *link = &component.links[constraint.variables[j] * LINKS];
+                while (*link >= 0)
+                    link++;
+                *link = static_cast<int>(i);
+            }
+        }
+        components.push_back(std::move(component));
+    }
+
+    // backtracks over the component's cells, counting solutions and per-cell mines by total mine count
+    void Probability::enumerate(Component &component) {
+        int size = static_cast<int>(component.cells.size());
+        int width = size + 1;
+        component.weights.assign(width, 0.0);
+        if (!component.exact)
+            return;
+        component.cellWeights.assign(size * width, 0.0);
+        std::vector<int> mines(component.constraints.size());
+        std::vector<int> open(component.constraints.size());
+        for (size_t i = 0; i < component.constraints.size(); i++) {
+            mines[i] = component.constraints[i].mines;
+            open[i] = component.constraints[i].size;
+            if (mines[i] < 0 || mines[i] > open[i])
+                component.exact = false;
+        }
+        if (!component.exact)
+            return;
+
+        auto apply = [&component, &mines, &open](int variable, int value, int sign) {
+            bool consistent = true;
+            for (int i = 0; i < LINKS; i++) {
+                int c = component.links[variable * LINKS + i];
+                if (c < 0)
+                    break;
+                open[c] -= sign;
+                mines[c] -= sign * value;
+                consistent = consistent && mines[c] >= 0 && mines[c] <= open[c];
+            }
+            return consistent;
+        };
+
+        std::vector<int> values(size, -1);
+        int variable = 0;
+        int count = 0;
+        long steps = 0;
+        while (variable >= 0) {
+            if (variable == size) {
+                component.weights[count] += 1.0;
+                for (int i = 0; i < size; i++)
+                    component.cellWeights[i * width + count] += values[i];
+                variable--;
+                continue;
+            }
+            if (values[variable] >= 0) {
+                apply(variable, values[variable], -1);
+                count -= values[variable];
+            }
+            if (values[variable] == 1) {
+                values[variable] = -1;
+                variable--;
+                continue;
+            }
+            if (++steps > MAX_STEPS) {
+                component.exact = false;
+                return;
+            }
+            values[variable]++;
+            count += values[variable];
+            if (apply(variable, values[variable], 1))
+                variable++;
+        }
+
+        double scale = *std::max_element(component.weights.begin(), component.weights.end());
+        if (scale == 0) {
+            component.exact = false;
+            return;
+        }
+        for (double &weight : component.weights)
+            weight /= scale;
+        for (double &weight : component.cellWeights)
+            weight /= scale;
+    }
+
+    std::vector<double> Probability::product(int first, int last) const {
+        if (last - first == 0)
+            return std::vector<double>{1.0};
+        if (last - first == 1)
+            return components[first].weights;
+        int mid = (first + last) / 2;
+        return convolve(product(first, mid), product(mid, last), std::max(remaining, 0) + 1);
+    }
+
+    // hands every component the mine count distribution of all the other components
+    void Probability::distribute(int first, int last, const std::vector<double> &outside) {
+        if (last - first == 0)
+            return;
+        if (last - first == 1) {
+            spread(components[first], outside);
+            return;
+        }
+        int mid = (first + last) / 2;
+        distribute(first, mid, convolve(outside, product(mid, last), binomials.size()));
+        distribute(mid, last, convolve(outside, product(first, mid), binomials.size()));
+    }
+
+    void Probability::spread(Component &component, const std::vector<double> &outside) {
+        int size = static_cast<int>(component.cells.size());
+        int width = size + 1;
+        std::vector<double> ratios(width, 0.0);
+        double total = 0;
+        for (int k = 0; k < width; k++) {
+            if (component.weights[k] == 0)
+                continue;
+            for (size_t j = 0; j < outside.size() && k + j < binomials.size(); j++)
+                ratios[k] += outside[j] * binomials[k + j];
+            total += component.weights[k] * ratios[k];
+        }
+        if (total <= 0)
+            return;
+        for (int i = 0; i < size; i++) {
+            double mines = 0;
+            for (int k = 0; k < width; k++)
+                mines += component.cellWeights[i * width + k] * ratios[k];
+            chances[component.cells[i]] = static_cast<float>(mines / total);
+        }
+    }
+
+    double Probability::logChoose(int n, int k) {
+        return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+    }
+
+    // truncated convolution, rescaled so that long products neither overflow nor underflow
+    std::vector<double> Probability::convolve(const std::vector<double> &a, const std::vector<double> &b,
+                                              size_t limit) {
+        std::vector<double> result(std::min(a.size() + b.size() - 1, limit), 0.0);
+        for (size_t i = 0; i < a.size() && i < result.size(); i++)
+            for (size_t j = 0; j < b.size() && i + j < result.size(); j++)
+                result[i + j] += a[i] * b[j];
+        double scale = result.empty() ? 0 : *std::max_element(result.begin(), result.end());
+        if (scale > 0)
+            for (double &value : result)
+                value /= scale;
+        return result;
+    }
+}
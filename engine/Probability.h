@@ -0,0 +1,59 @@
+#ifndef MINESWEEPER_PROBABILITY_H
+#define MINESWEEPER_PROBABILITY_H
+
+#include <cstdint>
+#include <vector>
+#include "../config/Options.h"
+#include "../util/ThreadPool.h"
+#include "Board.h"
+
+namespace minesweeper {
+    class Probability {
+    public:
+        Probability(const Board &board, const Options &options, ThreadPool *pool);
+        void compute();
+        [[nodiscard]] float getMineChance(int row, int col) const;
+        [[nodiscard]] bool isExact() const;
+        bool safest(int &row, int &col) const;
+    private:
+        struct Constraint {
+            int variables[8];
+            int size;
+            int mines;
+        };
+
+        struct Component {
+            std::vector<int> cells;
+            std::vector<Constraint> constraints;
+            std::vector<int> links;
+            std::vector<double> weights;
+            std::vector<double> cellWeights;
+            bool exact;
+        };
+
+        static constexpr int LINKS = 8;
+        static constexpr int MAX_COMPONENT = 2048;
+        static constexpr long MAX_STEPS = 1L << 24;
+        const Board &board;
+        const Options &options;
+        ThreadPool *pool;
+        std::vector<float> chances;
+        std::vector<int> visited;
+        std::vector<int> indices;
+        std::vector<Component> components;
+        std::vector<double> binomials;
+        int remaining;
+        int stamp;
+        bool exact;
+        [[nodiscard]] bool isUnknown(int n) const;
+        void gather(int start);
+        static void enumerate(Component &component);
+        std::vector<double> product(int first, int last) const;
+        void distribute(int first, int last, const std::vector<double> &outside);
+        void spread(Component &component, const std::vector<double> &outside);
+        static double logChoose(int n, int k);
+        static std::vector<double> convolve(const std::vector<double> &a, const std::vector<double> &b, size_t limit);
+    };
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef MINESWEEPER_RECORDER_H
+#define MINESWEEPER_RECORDER_H
+
+#include <cstdint>
+#include "../config/Options.h"
+#include "GameState.h"
+
+namespace minesweeper {
+    class Recorder {
+    public:
+        enum Move {
+            REVEAL,
+            FLAG,
+            CHORD
+        };
+
+        virtual void onDeal(const Options &options, uint64_t seed, bool noGuess, uint64_t layout, bool opened) = 0;
+        virtual void onMove(Move move, int row, int col) = 0;
+        virtual void onEnd(GameState state) = 0;
+        virtual ~Recorder() = default;
+    };
+};
+
+#endif
@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <cmath>
+#include "Solver.h"
+
+namespace minesweeper {
+    Solver::Solver(const Board &board, const Options &options) :
+            board(board),
+            options(options),
+            generation(board.getGeneration()),
+            changes(0),
+            stamp(0),
+            knowledge(options.getTiles(), UNKNOWN),
+            queued(options.getTiles(), 0),
+            visited(options.getTiles(), 0),
+            variables(options.getTiles(), 0) {
+        withGeometry(options, [this](const auto &geometry) { rebuild(geometry); });
+    }
+
+    // the geometry is picked once per update, so all the work below runs on the board's fixed shape if it has one
+    void Solver::update() {
+        withGeometry(options, [this](const auto &geometry) { update(geometry); });
+    }
+
+    bool Solver::nextSafe(int &row, int &col) {
+        int columns = options.getColumns();
+        while (!safe.empty()) {
+            int n = safe.back();
+            if (!board.isRevealed(n / columns, n % columns) && !board.isFlagged(n / columns, n % columns)) {
+                row = n / columns;
+                col = n % columns;
+                return true;
+            }
+            safe.pop_back();
+        }
+        return false;
+    }
+
+    bool Solver::nextMine(int &row, int &col) {
+        int columns = options.getColumns();
+        while (!mines.empty()) {
+            int n = mines.back();
+            if (!board.isFlagged(n / columns, n % columns)) {
+                row = n / columns;
+                col = n % columns;
+                return true;
+            }
+            mines.pop_back();
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool Solver::isSafe(int row, int col) const {
+        return knowledge[row * options.getColumns() + col] == SAFE;
+    }
+
+    [[nodiscard]] bool Solver::isMine(int row, int col) const {
+        return knowledge[row * options.getColumns() + col] == MINE;
+    }
+
+    // consumes the board's change journal, reprocessing only the constraints around the changed cells
+    template<typename Geometry>
+    void Solver::update(const Geometry &geometry) {
+        if (board.getGeneration() != generation) {
+            generation = board.getGeneration();
+            rebuild(geometry);
+            return;
+        }
+        const std::vector<int> &journal = board.getChanges();
+        int columns = geometry.getColumns();
+        bool unflagged = false;
+        for (; changes < journal.size(); changes++) {
+            int n = journal[changes];
+            if (board.isRevealed(n / columns, n % columns)) {
+                knowledge[n] = SAFE;
+                enqueue(geometry, n);
+                geometry.forEachNeighbor(n, [&geometry, this](int m) { enqueue(geometry, m); });
+            } else if (board.isFlagged(n / columns, n % columns)) {
+                if (knowledge[n] == UNKNOWN)
+                    mark(n, MINE);
+            } else {
+                unflagged = true;
+            }
+        }
+        // a removed flag may invalidate deductions that relied on it
+        if (unflagged)
+            rebuild(geometry);
+        else
+            propagate(geometry);
+    }
+
+    template<typename Geometry>
+    void Solver::rebuild(const Geometry &geometry) {
+        std::fill(knowledge.begin(), knowledge.end(), UNKNOWN);
+        std::fill(queued.begin(), queued.end(), 0);
+        queue.clear();
+        touched.clear();
+        safe.clear();
+        mines.clear();
+        marked.clear();
+        changes = board.getChanges().size();
+        for (int r = 0; r < geometry.getRows(); r++) {
+            for (int c = 0; c < geometry.getColumns(); c++) {
+                int n = r * geometry.getColumns() + c;
+                if (board.isRevealed(r, c))
+                    knowledge[n] = SAFE;
+                else if (board.isFlagged(r, c))
+                    knowledge[n] = MINE;
+            }
+        }
+        for (int n = 0; n < geometry.getTiles(); n++)
+            enqueue(geometry, n);
+        propagate(geometry);
+    }
+
+    // the constraints around a newly known cell are requeued by the next enqueueMarked
+    void Solver::mark(int n, Knowledge value) {
+        knowledge[n] = value;
+        (value == SAFE ? safe : mines).push_back(n);
+        marked.push_back(n);
+    }
+
+    template<typename Geometry>
+    void Solver::enqueue(const Geometry &geometry, int n) {
+        int columns = geometry.getColumns();
+        int r = n / columns;
+        int c = n % columns;
+        if (!queued[n] && board.isRevealed(r, c) && board.getAdjacentMines(r, c) > 0) {
+            queued[n] = 1;
+            queue.push_back(n);
+        }
+    }
+
+    // the component pass is deferred while local rules still leave a safe cell to open, and the touched
+    // components are only trusted to have nothing left once the whole frontier agrees
+    template<typename Geometry>
+    void Solver::propagate(const Geometry &geometry) {
+        int row, col;
+        do {
+            enqueueMarked(geometry);
+            while (!queue.empty()) {
+                int n = queue.back();
+                queue.pop_back();
+                queued[n] = 0;
+                touched.push_back(n);
+                solveLocal(geometry, n);
+                enqueueMarked(geometry);
+            }
+        } while (!nextSafe(row, col) &&
+                 (solveComponents(geometry) || (!nextMine(row, col) && solveFrontier(geometry))));
+    }
+
+    template<typename Geometry>
+    void Solver::enqueueMarked(const Geometry &geometry) {
+        for (int n : marked)
+            geometry.forEachNeighbor(n, [&geometry, this](int m) { enqueue(geometry, m); });
+        marked.clear();
+    }
+
+    // unknown neighbors of a revealed cell and the mines still hidden among them
+    template<typename Geometry>
+    bool Solver::constrain(const Geometry &geometry, int n, Constraint &constraint) const {
+        int columns = geometry.getColumns();
+        constraint.size = 0;
+        constraint.mines = board.getAdjacentMines(n / columns, n % columns);
+        geometry.forEachNeighbor(n, [&constraint, this](int m) {
+            if (knowledge[m] == MINE)
+                constraint.mines--;
+            else if (knowledge[m] == UNKNOWN)
+                constraint.cells[constraint.size++] = m;
+        });
+        return constraint.size > 0 && constraint.mines >= 0 && constraint.mines <= constraint.size;
+    }
+
+    template<typename Geometry>
+    bool Solver::solveLocal(const Geometry &geometry, int n) {
+        Constraint x{};
+        if (!constrain(geometry, n, x))
+            return false;
+        if (x.mines == 0 || x.mines == x.size) {
+            for (int i = 0; i < x.size; i++)
+                mark(x.cells[i], x.mines == 0 ? SAFE : MINE);
+            return true;
+        }
+
+        int columns = geometry.getColumns();
+        int row = n / columns;
+        int col = n % columns;
+        for (int r = std::max(row - 2, 0); r <= std::min(row + 2, geometry.getRows() - 1); r++) {
+            for (int c = std::max(col - 2, 0); c <= std::min(col + 2, columns - 1); c++) {
+                Constraint y{};
+                int m = r * columns + c;
+                if (m == n || !board.isRevealed(r, c) || !constrain(geometry, m, y))
+                    continue;
+                int onlyX[8], onlyY[8];
+                int sizeX = 0, sizeY = 0;
+                for (int i = 0; i < x.size; i++)
+                    if (std::find(y.cells, y.cells + y.size, x.cells[i]) == y.cells + y.size)
+                        onlyX[sizeX++] = x.cells[i];
+                for (int i = 0; i < y.size; i++)
+                    if (std::find(x.cells, x.cells + x.size, y.cells[i]) == x.cells + x.size)
+                        onlyY[sizeY++] = y.cells[i];
+                if (sizeX == x.size || sizeX + sizeY == 0)
+                    continue;
+                // mines(onlyY) - mines(onlyX) == y.mines - x.mines, so an extreme difference settles both sides
+                if (y.mines - x.mines == sizeY || x.mines - y.mines == sizeX) {
+                    bool yMines = y.mines - x.mines == sizeY;
+                    for (int i = 0; i < sizeX; i++)
+                        mark(onlyX[i], yMines ? SAFE : MINE);
+                    for (int i = 0; i < sizeY; i++)
+                        mark(onlyY[i], yMines ? MINE : SAFE);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    template<typename Geometry>
+    bool Solver::solveComponents(const Geometry &geometry) {
+        bool progress = false;
+        stamp++;
+        for (int n : touched)
+            if (visited[n] != stamp)
+                progress = solveComponent(geometry, n) || progress;
+        touched.clear();
+        return progress;
+    }
+
+    // every component of the frontier, in reading order, so a stall is reached on the position alone and not
+    // on the order in which the journal touched it
+    template<typename Geometry>
+    bool Solver::solveFrontier(const Geometry &geometry) {
+        int columns = geometry.getColumns();
+        bool progress = false;
+        stamp++;
+        touched.clear();
+        for (int n = 0; n < geometry.getTiles(); n++) {
+            Constraint k{};
+            if (visited[n] == stamp || !board.isRevealed(n / columns, n % columns) || !constrain(geometry, n, k))
+                continue;
+            progress = solveComponent(geometry, n) || progress;
+        }
+        return progress;
+    }
+
+    // gathers the constraints linked to the start cell through shared unknown cells
+    template<typename Geometry>
+    bool Solver::solveComponent(const Geometry &geometry, int start) {
+        int columns = geometry.getColumns();
+        std::vector<int> constraints{start};
+        std::vector<int> cells;
+        visited[start] = stamp;
+        for (size_t i = 0; i < constraints.size(); i++) {
+            Constraint k{};
+            if (!constrain(geometry, constraints[i], k))
+                continue;
+            for (int j = 0; j < k.size; j++) {
+                int v = k.cells[j];
+                if (visited[v] == stamp)
+                    continue;
+                visited[v] = stamp;
+                cells.push_back(v);
+                geometry.forEachNeighbor(v, [&constraints, columns, this](int m) {
+                    int r = m / columns;
+                    int c = m % columns;
+                    if (visited[m] != stamp && board.isRevealed(r, c) && board.getAdjacentMines(r, c) > 0) {
+                        visited[m] = stamp;
+                        constraints.push_back(m);
+                    }
+                });
+            }
+        }
+        if (constraints.size() < 2 || cells.empty() || static_cast<int>(cells.size()) > MAX_COMPONENT)
+            return false;
+        // the reduced form, and so what it proves, depends on the variable order; sorting fixes it by position
+        std::sort(constraints.begin(), constraints.end());
+        std::sort(cells.begin(), cells.end());
+        for (size_t i = 0; i < cells.size(); i++)
+            variables[cells[i]] = static_cast<int>(i);
+        return eliminate(geometry, constraints, cells);
+    }
+
+    // Gaussian elimination over the component; a reduced row whose right-hand side equals the sum of its
+    // positive or of its negative coefficients forces every variable in it
+    template<typename Geometry>
+    bool Solver::eliminate(const Geometry &geometry, std::vector<int> &constraints, std::vector<int> &cells) {
+        int rows = static_cast<int>(constraints.size());
+        int columns = static_cast<int>(cells.size());
+        int width = columns + 1;
+        std::vector<double> matrix(rows * width, 0.0);
+        for (int i = 0; i < rows; i++) {
+            Constraint k{};
+            constrain(geometry, constraints[i], k);
+            for (int j = 0; j < k.size; j++)
+                matrix[i * width + variables[k.cells[j]]] = 1.0;
+            matrix[i * width + columns] = k.mines;
+        }
+
+        int pivot = 0;
+        for (int col = 0; col < columns && pivot < rows; col++) {
+            int best = pivot;
+            for (int i = pivot + 1; i < rows; i++)
+                if (std::fabs(matrix[i * width + col]) > std::fabs(matrix[best * width + col]))
+                    best = i;
+            if (std::fabs(matrix[best * width + col]) < EPSILON)
+                continue;
+            for (int j = 0; j < width; j++)
+                std::swap(matrix[pivot * width + j], matrix[best * width + j]);
+            double scale = matrix[pivot * width + col];
+            for (int j = 0; j < width; j++)
+                matrix[pivot * width + j] /= scale;
+            for (int i = 0; i < rows; i++) {
+                double factor = matrix[i * width + col];
+                if (i == pivot || std::fabs(factor) < EPSILON)
+                    continue;
+                for (int j = 0; j < width; j++)
+                    matrix[i * width + j] -= factor * matrix[pivot * width + j];
+            }
+            pivot++;
+        }
+
+        std::vector<std::pair<int, Knowledge>> deductions;
+        for (int i = 0; i < pivot; i++) {
+            const double *row = &matrix[i * width];
+            double positive = 0, negative = 0;
+            for (int j = 0; j < columns; j++)
+                (row[j] > 0 ? positive : negative) += row[j];
+            bool upper = std::fabs(row[columns] - positive) < EPSILON;
+            bool lower = std::fabs(row[columns] - negative) < EPSILON;
+            if (!upper && !lower)
+                continue;
+            for (int j = 0; j < columns; j++) {
+                if (std::fabs(row[j]) < EPSILON)
+                    continue;
+                bool mine = (row[j] > 0) == upper;
+                deductions.emplace_back(cells[j], mine ? MINE : SAFE);
+            }
+        }
+
+        bool progress = false;
+        for (auto &[n, value] : deductions) {
+            if (knowledge[n] == UNKNOWN) {
+                mark(n, value);
+                progress = true;
+            }
+        }
+        return progress;
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef MINESWEEPER_SOLVER_H
+#define MINESWEEPER_SOLVER_H
+
+#include <cstdint>
+#include <vector>
+#include "../config/Geometry.h"
+#include "../config/Options.h"
+#include "Board.h"
+
+namespace minesweeper {
+    class Solver {
+    public:
+        Solver(const Board &board, const Options &options);
+        void update();
+        bool nextSafe(int &row, int &col);
+        bool nextMine(int &row, int &col);
+        [[nodiscard]] bool isSafe(int row, int col) const;
+        [[nodiscard]] bool isMine(int row, int col) const;
+    private:
+        enum Knowledge : uint8_t {
+            UNKNOWN,
+            SAFE,
+            MINE
+        };
+
+        struct Constraint {
+            int cells[8];
+            int size;
+            int mines;
+        };
+
+        static constexpr int MAX_COMPONENT = 256;
+        static constexpr double EPSILON = 1e-9;
+        const Board &board;
+        const Options &options;
+        int generation;
+        size_t changes;
+        int stamp;
+        std::vector<uint8_t> knowledge;
+        std::vector<uint8_t> queued;
+        std::vector<int> visited;
+        std::vector<int> variables;
+        std::vector<int> queue;
+        std::vector<int> touched;
+        std::vector<int> safe;
+        std::vector<int> mines;
+        std::vector<int> marked;
+        template<typename Geometry>
+        void update(const Geometry &geometry);
+        template<typename Geometry>
+        void rebuild(const Geometry &geometry);
+        void mark(int n, Knowledge value);
+        template<typename Geometry>
+        void enqueue(const Geometry &geometry, int n);
+        template<typename Geometry>
+        void propagate(const Geometry &geometry);
+        template<typename Geometry>
+        void enqueueMarked(const Geometry &geometry);
+        template<typename Geometry>
+        bool constrain(const Geometry &geometry, int n, Constraint &constraint) const;
+        template<typename Geometry>
+        bool solveLocal(const Geometry &geometry, int n);
+        template<typename Geometry>
+        bool solveComponents(const Geometry &geometry);
+        template<typename Geometry>
+        bool solveFrontier(const Geometry &geometry);
+        template<typename Geometry>
+        bool solveComponent(const Geometry &geometry, int start);
+        template<typename Geometry>
+        bool eliminate(const Geometry &geometry, std::vector<int> &constraints, std::vector<int> &cells);
+    };
+};
+
+#endif
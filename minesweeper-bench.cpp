@@ -0,0 +1,27 @@
+#include <cstdlib>
+#include <cstring>
+#include "bench/Benchmark.h"
+#include "bench/EngineBench.h"
+#ifdef MINESWEEPER_BENCH_RENDER
+#include "bench/RenderBench.h"
+#endif
+
+using namespace minesweeper;
+
+int main(int argc, char **argv) {
+    double budget = 0.25;
+    int maxSide = 1024;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "-b") == 0)
+            budget = std::atof(argv[i + 1]);
+        else if (std::strcmp(argv[i], "-m") == 0)
+            maxSide = std::atoi(argv[i + 1]);
+    }
+
+    Benchmark benchmark{budget};
+    EngineBench{benchmark, maxSide}.run();
+#ifdef MINESWEEPER_BENCH_RENDER
+    RenderBench{benchmark, maxSide}.run();
+#endif
+    return 0;
+}
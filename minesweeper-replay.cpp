@@ -0,0 +1,57 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include "config/Options.h"
+#include "engine/Board.h"
+#include "replay/Playback.h"
+#include "replay/ReplayReader.h"
+
+using namespace minesweeper;
+
+// re-runs every game of the given replays as fast as possible and checks each recorded result
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <replay>..." << std::endl;
+        return 1;
+    }
+
+    bool verified = true;
+    for (int i = 1; i < argc; i++) {
+        ReplayReader reader{argv[i]};
+        if (!reader.isValid()) {
+            std::cerr << argv[i] << ": " << reader.getError() << std::endl;
+            verified = false;
+            continue;
+        }
+
+        std::unique_ptr<Options> options;
+        std::unique_ptr<Board> board;
+        long games = 0, moves = 0, won = 0, lost = 0, mismatches = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const Record::Event &event : reader.getEvents()) {
+            if (event.kind == Record::DEAL) {
+                if (!options || event.rows != options->getRows() || event.columns != options->getColumns() ||
+                    event.mines != options->getMines()) {
+                    board.reset();
+                    options = std::make_unique<Options>(event.rows, event.columns, event.mines);
+                    board = std::make_unique<Board>(*options, event.seed);
+                }
+                games++;
+            } else if (event.kind == Record::END) {
+                won += event.state == GameState::WON;
+                lost += event.state == GameState::LOST;
+            } else {
+                moves++;
+            }
+            if (!Playback::apply(*board, *options, event))
+                mismatches++;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << argv[i] << ": " << games << " games, " << moves << " moves, " << won << " won, " << lost
+                  << " lost, " << mismatches << " mismatches, " << static_cast<long>(games / seconds)
+                  << " games/s" << std::endl;
+        verified = verified && mismatches == 0;
+    }
+    return verified ? 0 : 1;
+}
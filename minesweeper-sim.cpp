@@ -0,0 +1,124 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "config/Mode.h"
+#include "config/Options.h"
+#include "sim/Simulator.h"
+#include "sim/Strategy.h"
+#include "util/Parse.h"
+#include "util/ThreadPool.h"
+
+using namespace minesweeper;
+
+static int usage(const char *program) {
+    std::cerr << "usage: " << program << " <modes: any of b, i, e, c> [<rows> <columns> <mines>]"
+              << " [-g games] [-t random|first-safe|solver] [-s first seed] [-r seed ranges] [-j threads]"
+              << std::endl;
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || *argv[1] == '\0')
+        return usage(argv[0]);
+
+    std::vector<Mode::Enum> modes;
+    for (const char *mode = argv[1]; *mode != '\0'; mode++) {
+        Mode::Enum parsed;
+        if (!Mode::parse(*mode, parsed)) {
+            std::cerr << "unknown mode '" << *mode << "'" << std::endl;
+            return usage(argv[0]);
+        }
+        modes.push_back(parsed);
+    }
+    int arg = 2;
+    int custom[3]{0, 0, 0};
+    if (std::strchr(argv[1], 'c') != nullptr) {
+        if (argc < 5) {
+            std::cerr << "custom mode needs <rows> <columns> <mines>" << std::endl;
+            return 1;
+        }
+        for (int &value : custom) {
+            if (!parseInt(argv[arg], value)) {
+                std::cerr << "custom mode needs whole numbers, not '" << argv[arg] << "'" << std::endl;
+                return 1;
+            }
+            arg++;
+        }
+        if (!Options::isValid(custom[0], custom[1], custom[2])) {
+            std::cerr << "custom mode needs 1 to 10000 rows and columns and fewer mines than tiles" << std::endl;
+            return 1;
+        }
+    }
+
+    long games = 10000;
+    Strategy::Enum strategy = Strategy::SOLVER;
+    uint64_t seed = 1;
+    int ranges = 1;
+    int threads = 0;
+    for (; arg < argc; arg += 2) {
+        if (arg + 1 == argc) {
+            std::cerr << "missing value for " << argv[arg] << std::endl;
+            return usage(argv[0]);
+        }
+        if (std::strcmp(argv[arg], "-g") == 0) {
+            games = std::max(1L, std::atol(argv[arg + 1]));
+        } else if (std::strcmp(argv[arg], "-t") == 0) {
+            if (!Strategy::parse(argv[arg + 1], strategy)) {
+                std::cerr << "unknown strategy '" << argv[arg + 1] << "'" << std::endl;
+                return usage(argv[0]);
+            }
+        } else if (std::strcmp(argv[arg], "-s") == 0) {
+            seed = std::strtoull(argv[arg + 1], nullptr, 10);
+        } else if (std::strcmp(argv[arg], "-r") == 0) {
+            ranges = std::max(1, std::atoi(argv[arg + 1]));
+        } else if (std::strcmp(argv[arg], "-j") == 0) {
+            threads = std::atoi(argv[arg + 1]);
+        } else {
+            std::cerr << "unknown option " << argv[arg] << std::endl;
+            return usage(argv[0]);
+        }
+    }
+    ranges = static_cast<int>(std::min<long>(ranges, games));
+
+    ThreadPool pool{threads};
+    std::cout << std::left << std::setw(14) << "mode" << std::setw(12) << "strategy" << std::setw(44) << "seeds"
+              << std::right << std::setw(10) << "games" << std::setw(9) << "win %" << std::setw(9) << "3BV"
+              << std::setw(9) << "moves" << std::setw(12) << "games/s" << std::endl;
+    for (Mode::Enum mode : modes) {
+        Options options{mode == Mode::CUSTOM
+                        ? Options::getOptions(custom[0], custom[1], custom[2])
+                        : Options::getOptions(mode)};
+        Simulator simulator{options, strategy, pool};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Simulator::Report> reports{simulator.run(seed, games, ranges)};
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        Simulator::Report total{seed, 0, 0, 0, 0};
+        for (auto &report : reports) {
+            total.games += report.games;
+            total.wins += report.wins;
+            total.clicks += report.clicks;
+            total.moves += report.moves;
+        }
+        if (ranges > 1)
+            reports.push_back(total);
+        for (auto &report : reports) {
+            std::string seeds{std::to_string(report.firstSeed) + "-" +
+                              std::to_string(report.firstSeed + report.games - 1)};
+            std::cout << std::left << std::setw(14) << Mode::getName(mode)
+                      << std::setw(12) << Strategy::getName(strategy) << std::setw(44) << seeds << std::right
+                      << std::setw(10) << report.games << std::fixed << std::setprecision(2)
+                      << std::setw(9) << 100.0 * report.wins / report.games
+                      << std::setw(9) << static_cast<double>(report.clicks) / report.games
+                      << std::setw(9) << static_cast<double>(report.moves) / report.games;
+            if (&report == &reports.back())
+                std::cout << std::setw(12) << std::setprecision(0) << total.games / seconds;
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
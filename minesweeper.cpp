@@ -1,19 +1,97 @@
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include "SDL.h"
 #include "config/Mode.h"
 #include "config/Options.h"
 #include "config/Layout.h"
+#include "util/Parse.h"
+#include "util/Random.h"
 #include "sdl/ImageRepo.h"
 #include "sdl/Renderer.h"
 #include "sdl/Window.h"
 #include "sprite/Game.h"
+#include "replay/Playback.h"
+#include "replay/ReplayReader.h"
+#include "replay/ReplayWriter.h"
 
 using namespace minesweeper;
 
+// the standard mode with the replayed board size, whose background fits it
+static Mode::Enum getMode(const Record::Event &deal) {
+    for (Mode::Enum mode : {Mode::BEGINNER, Mode::INTERMEDIATE, Mode::EXPERT}) {
+        Options options{Options::getOptions(mode)};
+        if (options.getRows() == deal.rows && options.getColumns() == deal.columns &&
+            options.getMines() == deal.mines)
+            return mode;
+    }
+    return Mode::CUSTOM;
+}
+
 int main(int argc, char **argv) {
+    uint64_t seed = Random::randomSeed();
+    bool noGuess = false;
+    const char *record = nullptr;
+    const char *replay = nullptr;
+    double speed = 1.0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "-n") == 0) {
+            noGuess = true;
+        } else if (std::strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            record = argv[i + 1];
+        } else if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            replay = argv[i + 1];
+        } else if (std::strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            speed = std::atof(argv[i + 1]);
+        }
+    }
+
+    // a custom board is played as given or not at all, never clamped into one that was not asked for
     Mode::Enum mode = Mode::parse(argc > 1 ? *argv[1] : 'e');
-    Options options{Options::getOptions(mode)};
-    Layout layout{mode};
+    int custom[3]{0, 0, 0};
+    if (!replay && mode == Mode::CUSTOM &&
+        (argc < 5 || !parseInt(argv[2], custom[0]) || !parseInt(argv[3], custom[1]) ||
+         !parseInt(argv[4], custom[2]) || !Options::isValid(custom[0], custom[1], custom[2]))) {
+        std::cerr << "usage: " << argv[0] << " c <rows> <columns> <mines>, with 1 to 10000 rows and columns"
+                  << " and fewer mines than tiles" << std::endl;
+        return 1;
+    }
+
+    // a replay brings its own board size, seed and dealt layouts, so the game never searches for a no-guess one
+    std::unique_ptr<ReplayReader> reader;
+    Record::Event deal{};
+    if (replay) {
+        reader = std::make_unique<ReplayReader>(replay);
+        if (!reader->isValid() || reader->getEvents().empty()) {
+            std::cerr << replay << ": " << (reader->isValid() ? "empty replay" : reader->getError()) << std::endl;
+            return 1;
+        }
+        deal = reader->getEvents().front();
+        mode = getMode(deal);
+        seed = deal.seed;
+        noGuess = false;
+    }
+
+    Options options{reader
+                    ? Options::getOptions(deal.rows, deal.columns, deal.mines)
+                    : mode == Mode::CUSTOM
+                    ? Options::getOptions(custom[0], custom[1], custom[2])
+                    : Options::getOptions(mode)};
+    Layout layout{options};
+    std::cout << "seed: " << seed << std::endl;
+
+    std::unique_ptr<ReplayWriter> writer;
+    if (record) {
+        writer = std::make_unique<ReplayWriter>(record);
+        if (!writer->isOpen()) {
+            std::cerr << record << ": cannot open for writing or not a version "
+                      << static_cast<int>(Record::VERSION) << " replay log" << std::endl;
+            return 1;
+        }
+    }
 
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
@@ -24,7 +102,14 @@ int main(int argc, char **argv) {
     Renderer renderer{window.createRenderer()};
     ImageRepo imageRepo{renderer.createImageRepo("images/")};
 
-    Game game{imageRepo, renderer, options, layout, mode};
+    Game game{imageRepo, renderer, options, layout, mode, seed, noGuess};
+    if (writer)
+        game.setRecorder(writer.get());
+    std::unique_ptr<Playback> playback;
+    if (reader) {
+        playback = std::make_unique<Playback>(reader->getEvents(), speed);
+        game.setPlayback(playback.get());
+    }
     game.run();
 
     SDL_Quit();
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cmath>
+#include "Playback.h"
+
+namespace minesweeper {
+    Playback::Playback(const std::vector<Record::Event> &events, double speed) :
+            events(events),
+            next(0),
+            speed(speed > 0 ? speed : 1.0),
+            due(events.empty() ? 0 : static_cast<double>(events.front().delay) / this->speed),
+            start(clock_t::now()) {
+
+    }
+
+    // milliseconds until the next event is due, or -1 once the replay is over
+    [[nodiscard]] int Playback::getTimeout() const {
+        if (isFinished())
+            return -1;
+        return static_cast<int>(std::ceil(std::max(0.0, due - elapsed())));
+    }
+
+    [[nodiscard]] bool Playback::isFinished() const {
+        return next >= events.size();
+    }
+
+    // applies every event whose time has come; a deal for another board size ends the playback
+    void Playback::advance(Board &board, const Options &options) {
+        while (!isFinished() && due <= elapsed()) {
+            if (!apply(board, options, events[next]) && events[next].kind == Record::DEAL) {
+                next = events.size();
+                return;
+            }
+            if (++next < events.size())
+                due += static_cast<double>(events[next].delay) / speed;
+        }
+    }
+
+    // false when the event does not fit the board, or when a recorded game end differs from the replayed one
+    bool Playback::apply(Board &board, const Options &options, const Record::Event &event) {
+        int columns = options.getColumns();
+        if (event.kind == Record::DEAL) {
+            if (event.rows != options.getRows() || event.columns != columns || event.mines != options.getMines())
+                return false;
+            board.deal(event.seed, event.layout, event.noGuess, event.opened);
+            return true;
+        }
+        if (event.kind == Record::END)
+            return board.getState() == event.state;
+        if (event.cell < 0 || event.cell >= options.getTiles())
+            return false;
+        switch (event.kind) {
+            case Record::REVEAL:
+                board.reveal(event.cell / columns, event.cell % columns);
+                break;
+            case Record::FLAG:
+                board.toggleFlag(event.cell / columns, event.cell % columns);
+                break;
+            default:
+                board.clear(event.cell / columns, event.cell % columns);
+                break;
+        }
+        return true;
+    }
+
+    [[nodiscard]] double Playback::elapsed() const {
+        return std::chrono::duration<double, std::milli>(clock_t::now() - start).count();
+    }
+}
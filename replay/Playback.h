@@ -0,0 +1,29 @@
+#ifndef MINESWEEPER_PLAYBACK_H
+#define MINESWEEPER_PLAYBACK_H
+
+#include <chrono>
+#include <vector>
+#include "../config/Options.h"
+#include "../engine/Board.h"
+#include "Record.h"
+
+namespace minesweeper {
+    class Playback {
+    public:
+        Playback(const std::vector<Record::Event> &events, double speed);
+        [[nodiscard]] int getTimeout() const;
+        [[nodiscard]] bool isFinished() const;
+        void advance(Board &board, const Options &options);
+        static bool apply(Board &board, const Options &options, const Record::Event &event);
+    private:
+        using clock_t = std::chrono::steady_clock;
+        const std::vector<Record::Event> &events;
+        size_t next;
+        double speed;
+        double due;
+        clock_t::time_point start;
+        [[nodiscard]] double elapsed() const;
+    };
+};
+
+#endif
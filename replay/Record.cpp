@@ -0,0 +1,86 @@
+#include "Record.h"
+
+namespace minesweeper {
+    // varint(delay in ms), varint(cell << 2 | move); deals and game ends use the fourth move code with
+    // their own payload, and a deal that opened its start cell carries the layout the generator settled on
+    void Record::encode(const Event &event, std::vector<uint8_t> &out) {
+        putVarint(out, event.delay);
+        switch (event.kind) {
+            case Record::DEAL:
+                putVarint(out, uint64_t{0} << ACTION_BITS | META);
+                putVarint(out, event.rows);
+                putVarint(out, event.columns);
+                putVarint(out, event.mines);
+                putVarint(out, (event.noGuess ? NO_GUESS : 0) | (event.opened ? OPENED : 0));
+                putVarint(out, event.seed);
+                if (event.opened)
+                    putVarint(out, event.layout);
+                break;
+            case Record::END:
+                putVarint(out, uint64_t{1} << ACTION_BITS | META);
+                putVarint(out, static_cast<uint64_t>(event.state));
+                break;
+            default:
+                putVarint(out, static_cast<uint64_t>(event.cell) << ACTION_BITS | event.kind);
+                break;
+        }
+    }
+
+    bool Record::decode(const uint8_t *&in, const uint8_t *end, Event &event) {
+        uint64_t code;
+        event = Event{};
+        if (!getVarint(in, end, event.delay) || !getVarint(in, end, code))
+            return false;
+        if ((code & META) != META) {
+            event.kind = static_cast<Record::Enum>(code & META);
+            event.cell = static_cast<int>(code >> ACTION_BITS);
+            return (code >> ACTION_BITS) <= INT32_MAX;
+        }
+        uint64_t rows, columns, mines, flags, state;
+        switch (code >> ACTION_BITS) {
+            case 0:
+                event.kind = Record::DEAL;
+                if (!getVarint(in, end, rows) || !getVarint(in, end, columns) || !getVarint(in, end, mines) ||
+                    !getVarint(in, end, flags) || flags > (NO_GUESS | OPENED) || !getVarint(in, end, event.seed))
+                    return false;
+                event.layout = event.seed;
+                if ((flags & OPENED) && !getVarint(in, end, event.layout))
+                    return false;
+                event.rows = static_cast<int>(rows);
+                event.columns = static_cast<int>(columns);
+                event.mines = static_cast<int>(mines);
+                event.noGuess = (flags & NO_GUESS) != 0;
+                event.opened = (flags & OPENED) != 0;
+                // a board that could not be dealt makes the log corrupt, not something to build
+                return rows <= INT32_MAX && columns <= INT32_MAX && mines <= INT32_MAX &&
+                       Options::isValid(event.rows, event.columns, event.mines);
+            case 1:
+                event.kind = Record::END;
+                if (!getVarint(in, end, state) || state > static_cast<uint64_t>(GameState::LOST))
+                    return false;
+                event.state = static_cast<GameState>(state);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void Record::putVarint(std::vector<uint8_t> &out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    bool Record::getVarint(const uint8_t *&in, const uint8_t *end, uint64_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && in < end; shift += 7) {
+            uint8_t byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef MINESWEEPER_RECORD_H
+#define MINESWEEPER_RECORD_H
+
+#include <cstdint>
+#include <vector>
+#include "../config/Options.h"
+#include "../engine/GameState.h"
+
+namespace minesweeper {
+    class Record {
+    public:
+        enum Enum {
+            REVEAL,
+            FLAG,
+            CHORD,
+            DEAL,
+            END
+        };
+
+        struct Event {
+            Record::Enum kind;
+            uint64_t delay;
+            int cell;
+            int rows;
+            int columns;
+            int mines;
+            bool noGuess;
+            uint64_t seed;
+            uint64_t layout;
+            bool opened;
+            GameState state;
+        };
+
+        static constexpr char MAGIC[4]{'M', 'S', 'R', 'P'};
+        static constexpr uint8_t VERSION = 2;
+        static void encode(const Event &event, std::vector<uint8_t> &out);
+        static bool decode(const uint8_t *&in, const uint8_t *end, Event &event);
+    private:
+        static constexpr int ACTION_BITS = 2;
+        static constexpr uint64_t META = 3;
+        static constexpr uint64_t NO_GUESS = 1;
+        static constexpr uint64_t OPENED = 2;
+        static void putVarint(std::vector<uint8_t> &out, uint64_t value);
+        static bool getVarint(const uint8_t *&in, const uint8_t *end, uint64_t &value);
+    };
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include "ReplayReader.h"
+
+namespace minesweeper {
+    ReplayReader::ReplayReader(const char *path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            error = "cannot open file";
+            return;
+        }
+        std::vector<uint8_t> data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        if (data.size() < sizeof(Record::MAGIC) + 1 ||
+            !std::equal(std::begin(Record::MAGIC), std::end(Record::MAGIC), data.begin())) {
+            error = "not a replay file";
+            return;
+        }
+        // earlier versions stored no-guess deals by seed alone, and the generator no longer settles on the same
+        // layouts for all of them
+        int version = data[sizeof(Record::MAGIC)];
+        if (version != Record::VERSION) {
+            error = "replay format version " + std::to_string(version) + " is not supported, this build reads " +
+                    "version " + std::to_string(Record::VERSION);
+            return;
+        }
+        const uint8_t *next = data.data() + sizeof(Record::MAGIC) + 1;
+        const uint8_t *end = data.data() + data.size();
+        while (next < end) {
+            Record::Event event{};
+            if (!Record::decode(next, end, event)) {
+                error = "corrupt record at byte " + std::to_string(next - data.data());
+                return;
+            }
+            if (events.empty() && event.kind != Record::DEAL) {
+                error = "replay does not start with a deal";
+                return;
+            }
+            events.push_back(event);
+        }
+    }
+
+    [[nodiscard]] bool ReplayReader::isValid() const {
+        return error.empty();
+    }
+
+    [[nodiscard]] const std::string &ReplayReader::getError() const {
+        return error;
+    }
+
+    [[nodiscard]] const std::vector<Record::Event> &ReplayReader::getEvents() const {
+        return events;
+    }
+}
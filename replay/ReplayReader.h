@@ -0,0 +1,21 @@
+#ifndef MINESWEEPER_REPLAYREADER_H
+#define MINESWEEPER_REPLAYREADER_H
+
+#include <string>
+#include <vector>
+#include "Record.h"
+
+namespace minesweeper {
+    class ReplayReader {
+    public:
+        explicit ReplayReader(const char *path);
+        [[nodiscard]] bool isValid() const;
+        [[nodiscard]] const std::string &getError() const;
+        [[nodiscard]] const std::vector<Record::Event> &getEvents() const;
+    private:
+        std::vector<Record::Event> events;
+        std::string error;
+    };
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <iterator>
+#include "ReplayWriter.h"
+
+namespace minesweeper {
+    ReplayWriter::ReplayWriter(const char *path) :
+            last(clock_t::now()),
+            columns(0),
+            stopping(false),
+            worker(&ReplayWriter::work, this) {
+        // an existing log is only extended when it was written in the current format
+        char header[sizeof(Record::MAGIC) + 1];
+        std::ifstream existing(path, std::ios::binary);
+        existing.read(header, sizeof(header));
+        std::streamsize length = existing.gcount();
+        bool current = length == sizeof(header) &&
+                       std::equal(std::begin(Record::MAGIC), std::end(Record::MAGIC), header) &&
+                       static_cast<uint8_t>(header[sizeof(Record::MAGIC)]) == Record::VERSION;
+        if (length != 0 && !current)
+            return;
+        out.open(path, std::ios::binary | std::ios::app);
+        if (out && length == 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffer.insert(buffer.end(), std::begin(Record::MAGIC), std::end(Record::MAGIC));
+            buffer.push_back(Record::VERSION);
+        }
+    }
+
+    ReplayWriter::~ReplayWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        available.notify_one();
+        worker.join();
+    }
+
+    [[nodiscard]] bool ReplayWriter::isOpen() const {
+        return out.is_open() && static_cast<bool>(out);
+    }
+
+    void ReplayWriter::onDeal(const Options &options, uint64_t seed, bool noGuess, uint64_t layout, bool opened) {
+        columns = options.getColumns();
+        append({Record::DEAL, 0, 0, options.getRows(), options.getColumns(), options.getMines(), noGuess, seed,
+                layout, opened, GameState::INIT});
+    }
+
+    void ReplayWriter::onMove(Recorder::Move move, int row, int col) {
+        append({static_cast<Record::Enum>(move), 0, row * columns + col, 0, 0, 0, false, 0, 0, false,
+                GameState::INIT});
+    }
+
+    void ReplayWriter::onEnd(GameState state) {
+        append({Record::END, 0, 0, 0, 0, 0, false, 0, 0, false, state});
+    }
+
+    // encodes into memory on the caller's thread; the file is written by the worker
+    void ReplayWriter::append(Record::Event event) {
+        clock_t::time_point now = clock_t::now();
+        event.delay = std::chrono::duration_cast<std::chrono::milliseconds>(now - last).count();
+        last = now;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Record::encode(event, buffer);
+        }
+        available.notify_one();
+    }
+
+    void ReplayWriter::work() {
+        std::vector<uint8_t> pending;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            available.wait(lock, [this] { return stopping || !buffer.empty(); });
+            if (buffer.empty())
+                return;
+            pending.swap(buffer);
+            lock.unlock();
+            out.write(reinterpret_cast<const char *>(pending.data()), static_cast<std::streamsize>(pending.size()));
+            out.flush();
+            pending.clear();
+            lock.lock();
+        }
+    }
+}
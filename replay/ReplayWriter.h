@@ -0,0 +1,39 @@
+#ifndef MINESWEEPER_REPLAYWRITER_H
+#define MINESWEEPER_REPLAYWRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../engine/Recorder.h"
+#include "Record.h"
+
+namespace minesweeper {
+    class ReplayWriter : public Recorder {
+    public:
+        explicit ReplayWriter(const char *path);
+        ReplayWriter(const ReplayWriter &) = delete;
+        ReplayWriter &operator=(const ReplayWriter &) = delete;
+        ~ReplayWriter() override;
+        [[nodiscard]] bool isOpen() const;
+        void onDeal(const Options &options, uint64_t seed, bool noGuess, uint64_t layout, bool opened) override;
+        void onMove(Recorder::Move move, int row, int col) override;
+        void onEnd(GameState state) override;
+    private:
+        using clock_t = std::chrono::steady_clock;
+        std::ofstream out;
+        std::vector<uint8_t> buffer;
+        clock_t::time_point last;
+        int columns;
+        bool stopping;
+        std::mutex mutex;
+        std::condition_variable available;
+        std::thread worker;
+        void append(Record::Event event);
+        void work();
+    };
+};
+
+#endif
@@ -0,0 +1,67 @@
+#include "Batch.h"
+
+namespace minesweeper {
+    Batch::Batch(SDL_Renderer *ren, SDL_Texture *atlas, int atlasWidth, int atlasHeight) :
+            ren(ren),
+            atlas(atlas),
+            atlasWidth(static_cast<float>(atlasWidth)),
+            atlasHeight(static_cast<float>(atlasHeight)) {
+
+    }
+
+    void Batch::resize(int quads) {
+        vertices.resize(quads * QUAD_VERTICES, SDL_Vertex{{0, 0}, {255, 255, 255, 255}, {0, 0}});
+        indices.clear();
+    }
+
+    // maps the part of rect inside clip to the matching part of the texture's atlas region
+    void Batch::setQuad(int quad, const Texture &texture, const SDL_Rect *rect, const SDL_Rect *clip,
+                        SDL_Color color) {
+        SDL_Rect dst;
+        if (!SDL_IntersectRect(rect, clip, &dst))
+            dst = {0, 0, 0, 0};
+        const SDL_Rect &source = texture.getSource();
+        float scaleX = static_cast<float>(source.w) / static_cast<float>(rect->w);
+        float scaleY = static_cast<float>(source.h) / static_cast<float>(rect->h);
+        float u0 = (static_cast<float>(source.x) + static_cast<float>(dst.x - rect->x) * scaleX) / atlasWidth;
+        float v0 = (static_cast<float>(source.y) + static_cast<float>(dst.y - rect->y) * scaleY) / atlasHeight;
+        float u1 = u0 + static_cast<float>(dst.w) * scaleX / atlasWidth;
+        float v1 = v0 + static_cast<float>(dst.h) * scaleY / atlasHeight;
+        float x0 = static_cast<float>(dst.x);
+        float y0 = static_cast<float>(dst.y);
+        float x1 = static_cast<float>(dst.x + dst.w);
+        float y1 = static_cast<float>(dst.y + dst.h);
+
+        SDL_Vertex *v = &vertices[quad * QUAD_VERTICES];
+        v[0].position = {x0, y0};
+        v[0].tex_coord = {u0, v0};
+        v[1].position = {x1, y0};
+        v[1].tex_coord = {u1, v0};
+        v[2].position = {x0, y1};
+        v[2].tex_coord = {u0, v1};
+        v[3].position = {x1, y1};
+        v[3].tex_coord = {u1, v1};
+        for (int i = 0; i < QUAD_VERTICES; i++)
+            v[i].color = color;
+    }
+
+    void Batch::draw(int quad) {
+        for (int offset : OFFSETS)
+            indices.push_back(quad * QUAD_VERTICES + offset);
+    }
+
+    void Batch::drawAll() {
+        indices.clear();
+        int quads = static_cast<int>(vertices.size()) / QUAD_VERTICES;
+        for (int quad = 0; quad < quads; quad++)
+            draw(quad);
+    }
+
+    void Batch::render() {
+        if (!indices.empty()) {
+            SDL_RenderGeometry(ren, atlas, vertices.data(), static_cast<int>(vertices.size()),
+                               indices.data(), static_cast<int>(indices.size()));
+            indices.clear();
+        }
+    }
+}
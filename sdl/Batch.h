@@ -0,0 +1,31 @@
+#ifndef MINESWEEPER_BATCH_H
+#define MINESWEEPER_BATCH_H
+
+#include <vector>
+#include "SDL.h"
+#include "Texture.h"
+
+namespace minesweeper {
+    class Batch {
+    public:
+        Batch(SDL_Renderer *ren, SDL_Texture *atlas, int atlasWidth, int atlasHeight);
+        void resize(int quads);
+        void setQuad(int quad, const Texture &texture, const SDL_Rect *rect, const SDL_Rect *clip,
+                     SDL_Color color = {255, 255, 255, 255});
+        void draw(int quad);
+        void drawAll();
+        void render();
+    private:
+        static constexpr int QUAD_VERTICES = 4;
+        static constexpr int QUAD_INDICES = 6;
+        static constexpr int OFFSETS[QUAD_INDICES]{0, 1, 2, 2, 1, 3};
+        SDL_Renderer *ren;
+        SDL_Texture *atlas;
+        float atlasWidth;
+        float atlasHeight;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+}
+
+#endif
@@ -0,0 +1,15 @@
+#include "Image.h"
+
+namespace minesweeper {
+    const char *Image::getName(Image::Enum image) {
+        return NAMES[image];
+    }
+
+    Image::Enum Image::digit(int value) {
+        return static_cast<Image::Enum>(DIGIT_ZERO + value);
+    }
+
+    Image::Enum Image::tile(int adjacentMines) {
+        return static_cast<Image::Enum>(TILE_NONE + adjacentMines);
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef MINESWEEPER_IMAGE_H
+#define MINESWEEPER_IMAGE_H
+
+namespace minesweeper {
+    class Image {
+    public:
+        enum Enum {
+            BG_BEGINNER,
+            BG_INTERMEDIATE,
+            BG_EXPERT,
+            DIGIT_PANEL,
+            DIGIT_ZERO,
+            DIGIT_ONE,
+            DIGIT_TWO,
+            DIGIT_THREE,
+            DIGIT_FOUR,
+            DIGIT_FIVE,
+            DIGIT_SIX,
+            DIGIT_SEVEN,
+            DIGIT_EIGHT,
+            DIGIT_NINE,
+            FACE_PLAYING,
+            FACE_WIN,
+            FACE_LOSE,
+            TILE,
+            TILE_FLAG,
+            TILE_MINE,
+            TILE_NONE,
+            TILE_ONE,
+            TILE_TWO,
+            TILE_THREE,
+            TILE_FOUR,
+            TILE_FIVE,
+            TILE_SIX,
+            TILE_SEVEN,
+            TILE_EIGHT,
+            COUNT
+        };
+
+        static const char *getName(Image::Enum image);
+        static Image::Enum digit(int value);
+        static Image::Enum tile(int adjacentMines);
+    private:
+        static constexpr const char *NAMES[]{
+                "bg_beginner", "bg_intermediate", "bg_expert",
+                "digit_panel", "digit_zero", "digit_one", "digit_two", "digit_three", "digit_four",
+                "digit_five", "digit_six", "digit_seven", "digit_eight", "digit_nine",
+                "face_playing", "face_win", "face_lose",
+                "tile", "tile_flag", "tile_mine", "tile_none", "tile_one", "tile_two", "tile_three",
+                "tile_four", "tile_five", "tile_six", "tile_seven", "tile_eight"};
+    };
+}
+
+#endif
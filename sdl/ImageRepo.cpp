@@ -1,23 +1,68 @@
+#include <algorithm>
+#include <string>
 #include "ImageRepo.h"
 
 namespace minesweeper {
-    SDL_Texture *ImageRepo::load(const char *name) {
+    SDL_Surface *ImageRepo::load(const char *name) {
         std::string file{dir};
         file.append("minesweeper_");
         file.append(name);
         file.append(".bmp");
-        SDL_Surface *image = SDL_LoadBMP(file.c_str());
-        SDL_Texture *texture = SDL_CreateTextureFromSurface(ren, image);
-        SDL_FreeSurface(image);
-        return texture;
+        return SDL_LoadBMP(file.c_str());
     }
 
-    TexturePtr ImageRepo::get(const char *name) {
-        auto it = images.find(name);
-        return it != images.end() ? it->second : images[name] = std::make_shared<Texture>(ren, load(name));
+    // shelf-packs every image into a single atlas texture, tallest images first
+    void ImageRepo::pack() {
+        SDL_Surface *surfaces[Image::COUNT];
+        SDL_Rect rects[Image::COUNT];
+        int order[Image::COUNT];
+        for (int i = 0; i < Image::COUNT; i++) {
+            surfaces[i] = load(Image::getName(static_cast<Image::Enum>(i)));
+            rects[i] = {0, 0, surfaces[i] ? surfaces[i]->w : 0, surfaces[i] ? surfaces[i]->h : 0};
+            order[i] = i;
+        }
+        std::stable_sort(order, order + Image::COUNT, [&rects](int a, int b) { return rects[a].h > rects[b].h; });
+
+        int x = 0, y = 0, shelf = 0;
+        for (int i : order) {
+            if (x + rects[i].w > ATLAS_WIDTH) {
+                x = 0;
+                y += shelf + PADDING;
+                shelf = 0;
+            }
+            rects[i].x = x;
+            rects[i].y = y;
+            x += rects[i].w + PADDING;
+            shelf = std::max(shelf, rects[i].h);
+        }
+
+        atlasHeight = y + shelf;
+        SDL_Surface *sheet = SDL_CreateRGBSurfaceWithFormat(0, ATLAS_WIDTH, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+        for (int i = 0; i < Image::COUNT; i++) {
+            if (surfaces[i] != nullptr) {
+                SDL_Rect rect = rects[i];
+                SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(surfaces[i], nullptr, sheet, &rect);
+                SDL_FreeSurface(surfaces[i]);
+            }
+        }
+        atlas = SDL_CreateTextureFromSurface(ren, sheet);
+        SDL_FreeSurface(sheet);
+
+        for (int i = 0; i < Image::COUNT; i++) {
+            textures[i] = Texture{ren, atlas, rects[i]};
+        }
     }
 
-    ImageRepo::ImageRepo(SDL_Renderer *ren, const char *dir) : ren(ren), dir(dir) {
+    [[nodiscard]] Batch ImageRepo::createBatch() const {
+        return Batch{ren, atlas, ATLAS_WIDTH, atlasHeight};
+    }
+
+    ImageRepo::ImageRepo(SDL_Renderer *ren, const char *dir) : ren(ren), dir(dir), atlas(nullptr), atlasHeight(0) {
+        pack();
+    }
 
+    ImageRepo::~ImageRepo() {
+        SDL_DestroyTexture(atlas);
     }
-};
\ No newline at end of file
+};
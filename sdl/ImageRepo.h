@@ -1,20 +1,32 @@
 #ifndef MINESWEEPER_IMAGEREPO_H
 #define MINESWEEPER_IMAGEREPO_H
 
-#include <string>
-#include <map>
+#include <array>
+#include "Batch.h"
+#include "Image.h"
 #include "Texture.h"
 
 namespace minesweeper {
     class ImageRepo {
     public:
         ImageRepo(SDL_Renderer *ren, const char *dir);
-        TexturePtr get(const char *name);
+        ImageRepo(const ImageRepo &) = delete;
+        ImageRepo &operator=(const ImageRepo &) = delete;
+        ~ImageRepo();
+        [[nodiscard]] const Texture &get(Image::Enum image) const {
+            return textures[image];
+        }
+        [[nodiscard]] Batch createBatch() const;
     private:
+        static constexpr int ATLAS_WIDTH = 1024;
+        static constexpr int PADDING = 1;
         SDL_Renderer *ren;
         const char *dir;
-        std::map<std::string, TexturePtr> images;
-        SDL_Texture *load(const char *name);
+        SDL_Texture *atlas;
+        int atlasHeight;
+        std::array<Texture, Image::COUNT> textures;
+        SDL_Surface *load(const char *name);
+        void pack();
     };
 }
 
@@ -2,13 +2,19 @@
 
 namespace minesweeper {
     Renderer::Renderer(SDL_Window *win) :
-            ren(SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC)) {
+            ren(SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC)),
+            canvas(nullptr) {
         if (ren == nullptr) {
             ren = SDL_CreateRenderer(win, -1, 0);
         }
+        int w, h;
+        if (SDL_GetRendererOutputSize(ren, &w, &h) == 0) {
+            canvas = SDL_CreateTexture(ren, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, w, h);
+        }
     }
 
     Renderer::~Renderer() {
+        SDL_DestroyTexture(canvas);
         SDL_DestroyRenderer(ren);
     }
 
@@ -16,7 +22,22 @@ namespace minesweeper {
         return ImageRepo{ren, dir};
     }
 
+    [[nodiscard]] bool Renderer::isRetained() const {
+        return canvas != nullptr;
+    }
+
+    // sprites draw onto the retained canvas, so a frame only needs to redraw what changed
+    void Renderer::beginFrame() {
+        if (canvas != nullptr) {
+            SDL_SetRenderTarget(ren, canvas);
+        }
+    }
+
     void Renderer::repaint() {
+        if (canvas != nullptr) {
+            SDL_SetRenderTarget(ren, nullptr);
+            SDL_RenderCopy(ren, canvas, nullptr, nullptr);
+        }
         SDL_RenderPresent(ren);
     }
 }
@@ -10,9 +10,12 @@ namespace minesweeper {
         explicit Renderer(SDL_Window *win);
         ~Renderer();
         ImageRepo createImageRepo(const char *dir);
+        [[nodiscard]] bool isRetained() const;
+        void beginFrame();
         void repaint();
     private:
         SDL_Renderer *ren;
+        SDL_Texture *canvas;
     };
 };
 
@@ -1,19 +1,27 @@
 #include "Texture.h"
 
 namespace minesweeper {
-    Texture::Texture() : Texture(nullptr, nullptr) {
+    Texture::Texture() : Texture(nullptr, nullptr, {0, 0, 0, 0}) {
 
     }
 
-    Texture::Texture(SDL_Renderer *ren, SDL_Texture *texture) : ren(ren), texture(texture) {
+    Texture::Texture(SDL_Renderer *ren, SDL_Texture *atlas, SDL_Rect source) :
+            ren(ren),
+            atlas(atlas),
+            source(source) {
 
     }
 
-    Texture::~Texture() {
-        SDL_DestroyTexture(texture);
+    void Texture::render(const SDL_Rect *rect) const {
+        SDL_RenderCopy(ren, atlas, &source, rect);
     }
 
-    void Texture::render(SDL_Rect *rect) {
-        SDL_RenderCopy(ren, texture, nullptr, rect);
+    void Texture::renderSlice(const SDL_Rect *slice, const SDL_Rect *rect) const {
+        SDL_Rect src{source.x + slice->x, source.y + slice->y, slice->w, slice->h};
+        SDL_RenderCopy(ren, atlas, &src, rect);
+    }
+
+    [[nodiscard]] const SDL_Rect &Texture::getSource() const {
+        return source;
     }
 }
@@ -1,22 +1,21 @@
 #ifndef MINESWEEPER_TEXTURE_H
 #define MINESWEEPER_TEXTURE_H
 
-#include <memory>
 #include "SDL.h"
 
 namespace minesweeper {
     class Texture {
     public:
         Texture();
-        Texture(SDL_Renderer *ren, SDL_Texture *texture);
-        ~Texture();
-        void render(SDL_Rect *rect);
+        Texture(SDL_Renderer *ren, SDL_Texture *atlas, SDL_Rect source);
+        void render(const SDL_Rect *rect) const;
+        void renderSlice(const SDL_Rect *slice, const SDL_Rect *rect) const;
+        [[nodiscard]] const SDL_Rect &getSource() const;
     private:
         SDL_Renderer *ren;
-        SDL_Texture *texture;
+        SDL_Texture *atlas;
+        SDL_Rect source;
     };
-
-    using TexturePtr = std::shared_ptr<Texture>;
 }
 
 #endif
@@ -0,0 +1,96 @@
+#include "Player.h"
+
+namespace minesweeper {
+    Player::Player(Board &board, const Options &options, Strategy::Enum strategy) :
+            board(board),
+            options(options),
+            strategy(strategy),
+            random(0),
+            solver(board, options),
+            probability(board, options, nullptr) {
+
+    }
+
+    // plays the game dealt for the seed to the end and returns the number of moves made
+    int Player::play(uint64_t seed) {
+        board.reset(seed);
+        random = Random{Random::nextSeed(seed)};
+        int moves = 0;
+        while (!isGameOver()) {
+            move();
+            moves++;
+        }
+        return moves;
+    }
+
+    void Player::move() {
+        int row, col;
+        switch (strategy) {
+            case Strategy::RANDOM:
+                guess();
+                break;
+            case Strategy::FIRST_SAFE:
+                if (!deduce())
+                    guess();
+                break;
+            default:
+                solver.update();
+                if (solver.nextSafe(row, col)) {
+                    board.reveal(row, col);
+                } else if (solver.nextMine(row, col)) {
+                    board.toggleFlag(row, col);
+                } else if (board.getState() == GameState::INIT) {
+                    board.reveal(options.getRows() / 2, options.getColumns() / 2);
+                } else {
+                    probability.compute();
+                    if (probability.safest(row, col))
+                        board.reveal(row, col);
+                }
+                break;
+        }
+    }
+
+    void Player::guess() {
+        int row, col;
+        do {
+            row = random.randomInt(0, options.getRows() - 1);
+            col = random.randomInt(0, options.getColumns() - 1);
+        } while (board.isRevealed(row, col) || board.isFlagged(row, col));
+        board.reveal(row, col);
+    }
+
+    // the first number, in reading order, that either has all its mines flagged or all its hidden cells mined
+    bool Player::deduce() {
+        for (int r = 0; r < options.getRows(); r++) {
+            for (int c = 0; c < options.getColumns(); c++) {
+                if (!board.isRevealed(r, c) || board.getAdjacentMines(r, c) == 0)
+                    continue;
+                int hidden = 0, flagged = 0, row = -1, col = -1;
+                options.forEachNeighbor(r, c, [&](int nr, int nc) {
+                    if (board.isFlagged(nr, nc)) {
+                        flagged++;
+                    } else if (!board.isRevealed(nr, nc)) {
+                        hidden++;
+                        row = nr;
+                        col = nc;
+                    }
+                });
+                if (hidden == 0)
+                    continue;
+                if (flagged == board.getAdjacentMines(r, c)) {
+                    board.clear(r, c);
+                    return true;
+                }
+                if (hidden + flagged == board.getAdjacentMines(r, c)) {
+                    board.toggleFlag(row, col);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool Player::isGameOver() const {
+        return board.getState() == GameState::WON || board.getState() == GameState::LOST;
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef MINESWEEPER_PLAYER_H
+#define MINESWEEPER_PLAYER_H
+
+#include <cstdint>
+#include "../config/Options.h"
+#include "../engine/Board.h"
+#include "../engine/Probability.h"
+#include "../engine/Solver.h"
+#include "../util/Random.h"
+#include "Strategy.h"
+
+namespace minesweeper {
+    class Player {
+    public:
+        Player(Board &board, const Options &options, Strategy::Enum strategy);
+        int play(uint64_t seed);
+    private:
+        Board &board;
+        const Options &options;
+        Strategy::Enum strategy;
+        Random random;
+        Solver solver;
+        Probability probability;
+        void move();
+        void guess();
+        bool deduce();
+        [[nodiscard]] bool isGameOver() const;
+    };
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <mutex>
+#include "Simulator.h"
+#include "Player.h"
+
+namespace minesweeper {
+    Simulator::Simulator(const Options &options, Strategy::Enum strategy, ThreadPool &pool) :
+            options(options),
+            strategy(strategy),
+            pool(pool) {
+
+    }
+
+    // plays the games for consecutive seeds in chunks on the pool, reporting each seed range separately
+    std::vector<Simulator::Report> Simulator::run(uint64_t firstSeed, long games, int ranges) {
+        std::vector<Report> reports(ranges);
+        std::mutex mutex;
+        for (int i = 0; i < ranges; i++) {
+            long begin = games * i / ranges;
+            long end = games * (i + 1) / ranges;
+            reports[i] = {firstSeed + begin, end - begin, 0, 0, 0};
+            for (long chunk = begin; chunk < end; chunk += CHUNK) {
+                long count = std::min(CHUNK, end - chunk);
+                pool.submit([&reports, &mutex, i, count, seed = firstSeed + chunk, this] {
+                    Report report = play(seed, count);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    reports[i].wins += report.wins;
+                    reports[i].clicks += report.clicks;
+                    reports[i].moves += report.moves;
+                });
+            }
+        }
+        pool.wait();
+        return reports;
+    }
+
+    Simulator::Report Simulator::play(uint64_t firstSeed, long games) const {
+        Report report{firstSeed, games, 0, 0, 0};
+        Board board{options, firstSeed};
+        Player player{board, options, strategy};
+        for (long i = 0; i < games; i++) {
+            report.moves += player.play(firstSeed + i);
+            report.wins += board.getState() == GameState::WON;
+            report.clicks += board.getClicks();
+        }
+        return report;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef MINESWEEPER_SIMULATOR_H
+#define MINESWEEPER_SIMULATOR_H
+
+#include <cstdint>
+#include <vector>
+#include "../config/Options.h"
+#include "../engine/Board.h"
+#include "../util/ThreadPool.h"
+#include "Strategy.h"
+
+namespace minesweeper {
+    class Simulator {
+    public:
+        struct Report {
+            uint64_t firstSeed;
+            long games;
+            long wins;
+            long clicks;
+            long moves;
+        };
+
+        Simulator(const Options &options, Strategy::Enum strategy, ThreadPool &pool);
+        std::vector<Report> run(uint64_t firstSeed, long games, int ranges);
+    private:
+        static constexpr long CHUNK = 64;
+        const Options &options;
+        Strategy::Enum strategy;
+        ThreadPool &pool;
+        Report play(uint64_t firstSeed, long games) const;
+    };
+};
+
+#endif
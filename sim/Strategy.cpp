@@ -0,0 +1,27 @@
+#include <cstring>
+#include <initializer_list>
+#include "Strategy.h"
+
+namespace minesweeper {
+    // false, leaving the strategy alone, for a name that matches none
+    bool Strategy::parse(const char *name, Strategy::Enum &strategy) {
+        for (Strategy::Enum candidate : {Strategy::RANDOM, Strategy::FIRST_SAFE, Strategy::SOLVER}) {
+            if (std::strcmp(name, getName(candidate)) == 0) {
+                strategy = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const char *Strategy::getName(Strategy::Enum strategy) {
+        switch (strategy) {
+            case Strategy::RANDOM:
+                return "random";
+            case Strategy::FIRST_SAFE:
+                return "first-safe";
+            default:
+                return "solver";
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef MINESWEEPER_STRATEGY_H
+#define MINESWEEPER_STRATEGY_H
+
+namespace minesweeper {
+    class Strategy {
+    public:
+        enum Enum {
+            RANDOM,
+            FIRST_SAFE,
+            SOLVER
+        };
+
+        static bool parse(const char *name, Strategy::Enum &strategy);
+        static const char *getName(Strategy::Enum strategy);
+    };
+}
+
+#endif
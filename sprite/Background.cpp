@@ -2,22 +2,42 @@
 
 namespace minesweeper {
     Background::Background(ImageRepo &imageRepo, const Layout &layout, Mode::Enum mode)
-            : Sprite(imageRepo, layout.getBackground()), mode(mode) {
+            : Sprite(imageRepo, layout.getBackground()), mode(mode), texture(imageRepo.get(getBackground(mode))) {
 
     }
 
-    const char *Background::getBackground() {
+    Image::Enum Background::getBackground(Mode::Enum mode) {
         switch (mode) {
             case Mode::BEGINNER:
-                return "bg_beginner";
+                return Image::BG_BEGINNER;
             case Mode::INTERMEDIATE:
-                return "bg_intermediate";
+                return Image::BG_INTERMEDIATE;
             default:
-                return "bg_expert";
+                return Image::BG_EXPERT;
         }
     }
 
     void Background::render() {
-        imageRepo.get(getBackground())->render(&boundingBox);
+        if (mode == Mode::CUSTOM) {
+            renderSlices();
+        } else {
+            texture.render(&boundingBox);
+        }
+        dirty = false;
+    }
+
+    // stretches the expert background around its fixed borders to fit any window size
+    void Background::renderSlices() {
+        int srcX[]{0, SLICE_LEFT, SLICE_WIDTH - SLICE_RIGHT, SLICE_WIDTH};
+        int srcY[]{0, SLICE_TOP, SLICE_HEIGHT - SLICE_BOTTOM, SLICE_HEIGHT};
+        int dstX[]{0, SLICE_LEFT, boundingBox.w - SLICE_RIGHT, boundingBox.w};
+        int dstY[]{0, SLICE_TOP, boundingBox.h - SLICE_BOTTOM, boundingBox.h};
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                SDL_Rect src{srcX[j], srcY[i], srcX[j + 1] - srcX[j], srcY[i + 1] - srcY[i]};
+                SDL_Rect dst{dstX[j], dstY[i], dstX[j + 1] - dstX[j], dstY[i + 1] - dstY[i]};
+                texture.renderSlice(&src, &dst);
+            }
+        }
     }
 }
@@ -10,8 +10,16 @@ namespace minesweeper {
         Background(ImageRepo &imageRepo, const Layout &layout, Mode::Enum mode);
         void render() override;
     private:
+        static constexpr int SLICE_WIDTH = 630;
+        static constexpr int SLICE_HEIGHT = 416;
+        static constexpr int SLICE_LEFT = 15;
+        static constexpr int SLICE_TOP = 81;
+        static constexpr int SLICE_RIGHT = 15;
+        static constexpr int SLICE_BOTTOM = 15;
         Mode::Enum mode;
-        const char *getBackground();
+        const Texture &texture;
+        static Image::Enum getBackground(Mode::Enum mode);
+        void renderSlices();
     };
 
     using BackgroundPtr = std::shared_ptr<Background>;
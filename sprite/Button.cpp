@@ -1,60 +1,41 @@
 #include "Button.h"
 
 namespace minesweeper {
-    Button::Button(ImageRepo &imageRepo, const Options &options, const Layout &layout) :
+    Button::Button(ImageRepo &imageRepo, Board &board, const Layout &layout) :
             Sprite(imageRepo, layout.getFace()),
-            state(GameState::INIT),
-            revealed(0),
-            options(options) {
+            board(board),
+            playing(imageRepo.get(Image::FACE_PLAYING)),
+            win(imageRepo.get(Image::FACE_WIN)),
+            lose(imageRepo.get(Image::FACE_LOSE)) {
 
     }
 
-    void Button::setListeners(const std::vector<GameStateListenerWPtr> &v) {
-        listeners = v;
-    }
-
     void Button::handleClick(SDL_MouseButtonEvent evt) {
-        state = GameState::INIT;
-        revealed = 0;
-        notifyListeners();
+        board.reset();
     }
 
-    void Button::onReveal(bool mine, bool adjacentMines) {
-        if (mine) {
-            state = GameState::LOST;
-            notifyListeners();
-        } else {
-            if (state == GameState::INIT) {
-                state = GameState::PLAYING;
-                notifyListeners();
-            }
-            revealed++;
-            if (revealed == options.getBlanks()) {
-                state = GameState::WON;
-                notifyListeners();
-            }
-        }
+    bool Button::isDirty() {
+        return dirty;
     }
 
     void Button::render() {
-        getFaceImage()->render(&boundingBox);
+        getFaceImage().render(&boundingBox);
+        dirty = false;
     }
 
-    TexturePtr Button::getFaceImage() {
-        switch (state) {
+    void Button::onEvent(GameState state) {
+        dirty = true;
+    }
+
+    const Texture &Button::getFaceImage() {
+        switch (board.getState()) {
             case GameState::INIT:
             case GameState::PLAYING:
-                return imageRepo.get("face_playing");
+                return playing;
             case GameState::WON:
-                return imageRepo.get("face_win");
+                return win;
             default:
-                return imageRepo.get("face_lose");
+                return lose;
         }
     }
-
-    void Button::notifyListeners() {
-        for (auto &listener : listeners)
-            if (auto spt = listener.lock())
-                spt->onStateChange(state);
-    }
 }
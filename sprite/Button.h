@@ -1,28 +1,24 @@
 #ifndef MINESWEEPER_BUTTON_H
 #define MINESWEEPER_BUTTON_H
 
-#include <vector>
-#include "../config/Options.h"
 #include "../config/Layout.h"
-#include "TileListener.h"
+#include "../engine/Board.h"
 #include "Sprite.h"
-#include "GameStateListener.h"
 
 namespace minesweeper {
-    class Button : public Sprite, public TileListener {
+    class Button : public Sprite {
     public:
-        Button(ImageRepo &imageRepo, const Options &options, const Layout &layout);
-        void setListeners(const std::vector<GameStateListenerWPtr> &v);
+        Button(ImageRepo &imageRepo, Board &board, const Layout &layout);
         void handleClick(SDL_MouseButtonEvent evt) override;
-        void onReveal(bool mine, bool adjacentMines) override;
+        bool isDirty() override;
         void render() override;
+        void onEvent(GameState state);
     private:
-        GameState state;
-        int revealed;
-        const Options &options;
-        std::vector<GameStateListenerWPtr> listeners;
-        TexturePtr getFaceImage();
-        void notifyListeners();
+        Board &board;
+        const Texture &playing;
+        const Texture &win;
+        const Texture &lose;
+        const Texture &getFaceImage();
     };
 
     using ButtonPtr = std::shared_ptr<Button>;
@@ -1,8 +1,12 @@
 #include "DigitPanel.h"
 
 namespace minesweeper {
+    bool DigitPanel::isDirty() {
+        return dirty || getDisplayValue() != displayed;
+    }
+
     void DigitPanel::render() {
-        imageRepo.get("digit_panel")->render(&boundingBox);
+        panel.render(&boundingBox);
 
         int value = getDisplayValue();
         int onesDigit = value % 10;
@@ -10,16 +14,23 @@ namespace minesweeper {
         int hundredsDigit = (value / 100) % 10;
 
         SDL_Rect rect = getDigitRect(0);
-        imageRepo.get(DIGITS[hundredsDigit])->render(&rect);
+        digits[hundredsDigit]->render(&rect);
 
         rect = getDigitRect(1);
-        imageRepo.get(DIGITS[tensDigit])->render(&rect);
+        digits[tensDigit]->render(&rect);
 
         rect = getDigitRect(2);
-        imageRepo.get(DIGITS[onesDigit])->render(&rect);
-    }
+        digits[onesDigit]->render(&rect);
 
-    DigitPanel::DigitPanel(ImageRepo &imageRepo, SDL_Rect boundingBox) : Sprite(imageRepo, boundingBox) {
+        displayed = value;
+        dirty = false;
+    }
 
+    DigitPanel::DigitPanel(ImageRepo &imageRepo, SDL_Rect boundingBox) :
+            Sprite(imageRepo, boundingBox),
+            panel(imageRepo.get(Image::DIGIT_PANEL)),
+            displayed(-1) {
+        for (int i = 0; i < DIGITS; i++)
+            digits[i] = &imageRepo.get(Image::digit(i));
     }
 }
@@ -7,14 +7,17 @@
 namespace minesweeper {
     class DigitPanel : public Sprite {
     public:
+        bool isDirty() override;
         void render() override;
     protected:
         DigitPanel(ImageRepo &imageRepo, SDL_Rect boundingBox);
         virtual SDL_Rect getDigitRect(int position) = 0;
         virtual int getDisplayValue() = 0;
     private:
-        static constexpr const char *DIGITS[]{"digit_zero", "digit_one", "digit_two", "digit_three", "digit_four",
-                                              "digit_five", "digit_six", "digit_seven", "digit_eight", "digit_nine"};
+        static constexpr int DIGITS = 10;
+        const Texture &panel;
+        const Texture *digits[DIGITS];
+        int displayed;
     };
 };
 
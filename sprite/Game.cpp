@@ -7,57 +7,196 @@
 #include "Grid.h"
 
 namespace minesweeper {
-    Game::Game(ImageRepo &imageRepo, Renderer &renderer, const Options &options, const Layout &layout, Mode::Enum mode)
-            : renderer(renderer) {
-        BackgroundPtr background{std::make_shared<Background>(imageRepo, layout, mode)};
-        TimerPtr timer{std::make_shared<Timer>(imageRepo, layout)};
-        FlagCounterPtr flagCounter{std::make_shared<FlagCounter>(imageRepo, options, layout)};
-        ButtonPtr button{std::make_shared<Button>(imageRepo, options, layout)};
-        GridPtr grid{std::make_shared<Grid>(imageRepo, options, layout)};
+    Game::Game(ImageRepo &imageRepo, Renderer &renderer, const Options &options, const Layout &layout, Mode::Enum mode,
+               uint64_t seed, bool noGuess)
+            : renderer(renderer), options(options), board(options, seed), solver(board, options),
+              probability(board, options, &pool),
+              background(noGuess ? std::make_unique<ThreadPool>() : nullptr),
+              generator(noGuess ? std::make_unique<Generator>(options, *background) : nullptr),
+              dealer(options, background.get()), playback(nullptr), overlay(false),
+              state(GameState::INIT), timer(std::make_shared<Timer>(imageRepo, layout)),
+              button(std::make_shared<Button>(imageRepo, board, layout)),
+              grid(std::make_shared<Grid>(imageRepo, board, options, layout)), bus(*timer, *button) {
+        BackgroundPtr backdrop{std::make_shared<Background>(imageRepo, layout, mode)};
+        FlagCounterPtr flagCounter{std::make_shared<FlagCounter>(imageRepo, board, layout)};
 
-        std::vector<GameStateListenerWPtr> gameStateListeners{grid, timer, flagCounter};
-        button->setListeners(gameStateListeners);
-
-        std::vector<TileListenerWPtr> tileRevealListeners{button, flagCounter};
-        grid->setListeners(tileRevealListeners);
-
-        std::vector<FlagStateListenerWPtr> flagStateListeners{grid};
-        flagCounter->setListeners(flagStateListeners);
+        if (generator) {
+            board.setGenerator(generator.get());
+            board.reset(seed);
+        }
+        board.setDealer(&dealer);
+        dealer.deal(seed);
 
-        sprites.push_back(background);
+        sprites.push_back(backdrop);
         sprites.push_back(timer);
         sprites.push_back(flagCounter);
         sprites.push_back(button);
         sprites.push_back(grid);
     }
 
+    // re-deals the current board so that the log opens with its deal
+    void Game::setRecorder(Recorder *recorder) {
+        board.setRecorder(recorder);
+        board.reset(board.getSeed());
+    }
+
+    void Game::setPlayback(Playback *playback) {
+        this->playback = playback;
+    }
+
     void Game::run() {
         render();
-        while (true) {
+        bool running = true;
+        while (running) {
             SDL_Event e;
-            int res = SDL_WaitEventTimeout(&e, 100);
-            if (res != 0) {
-                if (e.type == SDL_QUIT) {
-                    break;
-                } else if (e.type == SDL_MOUSEBUTTONDOWN) {
-                    onClick(e.button);
-                    render();
-                }
-            } else {
-                // render on timeout
-                render();
+            int timeout = getTimeout();
+            int res = timeout < 0 ? SDL_WaitEvent(&e) : SDL_WaitEventTimeout(&e, timeout);
+            // drain everything queued so that a burst of input costs a single frame
+            for (; res != 0 && running; res = SDL_PollEvent(&e))
+                running = onEvent(e);
+            if (running && playback && !playback->isFinished()) {
+                playback->advance(board, options);
+                onMove();
             }
+            if (running)
+                render();
         }
     }
 
+    [[nodiscard]] int Game::getTimeout() const {
+        int timeout = timer->getTimeout();
+        int next = playback ? playback->getTimeout() : -1;
+        if (timeout < 0 || (next >= 0 && next < timeout))
+            return next;
+        return timeout;
+    }
+
+    bool Game::onEvent(SDL_Event &e) {
+        if (e.type == SDL_QUIT) {
+            return false;
+        } else if (e.type == SDL_MOUSEBUTTONDOWN) {
+            onClick(e.button);
+        } else if (e.type == SDL_MOUSEWHEEL) {
+            onScroll(e.wheel.x * WHEEL_TILES, -e.wheel.y * WHEEL_TILES);
+        } else if (e.type == SDL_KEYDOWN) {
+            onKey(e.key);
+        } else if (e.type == SDL_WINDOWEVENT) {
+            onWindowEvent(e.window);
+        } else if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+            invalidate();
+        }
+        return true;
+    }
+
     void Game::onClick(SDL_MouseButtonEvent evt) {
+        // the board belongs to the replay until it is over
+        if (playback && !playback->isFinished())
+            return;
         for (auto &sprite : sprites)
             sprite->onClick(evt);
+        onMove();
+    }
+
+    void Game::onKey(SDL_KeyboardEvent evt) {
+        switch (evt.keysym.sym) {
+            case SDLK_LEFT:
+                onScroll(-1, 0);
+                break;
+            case SDLK_RIGHT:
+                onScroll(1, 0);
+                break;
+            case SDLK_UP:
+                onScroll(0, -1);
+                break;
+            case SDLK_DOWN:
+                onScroll(0, 1);
+                break;
+            case SDLK_h:
+                hint();
+                break;
+            case SDLK_p:
+                toggleOverlay();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void Game::onScroll(int dx, int dy) {
+        for (auto &sprite : sprites)
+            sprite->scroll(dx, dy);
+    }
+
+    // reveals a cell proven safe, else flags a proven mine, else opens the cell least likely to hold a mine
+    void Game::hint() {
+        if (playback && !playback->isFinished())
+            return;
+        int row, col;
+        solver.update();
+        if (solver.nextSafe(row, col)) {
+            board.reveal(row, col);
+        } else if (solver.nextMine(row, col)) {
+            board.toggleFlag(row, col);
+        } else if (board.getState() == GameState::INIT) {
+            board.reveal(options.getRows() / 2, options.getColumns() / 2);
+        } else if (board.getState() == GameState::PLAYING) {
+            probability.compute();
+            if (probability.safest(row, col))
+                board.reveal(row, col);
+        }
+        onMove();
+    }
+
+    void Game::toggleOverlay() {
+        overlay = !overlay;
+        if (overlay)
+            probability.compute();
+        grid->setOverlay(overlay ? &probability : nullptr);
+    }
+
+    // every board change goes through here, so this is where state changes reach the other components
+    void Game::onMove() {
+        if (board.getState() != state) {
+            state = board.getState();
+            bus.publish(state);
+        }
+        solver.update();
+        if (overlay) {
+            probability.compute();
+            grid->invalidate();
+        }
+    }
+
+    void Game::onWindowEvent(SDL_WindowEvent evt) {
+        if (evt.event == SDL_WINDOWEVENT_EXPOSED) {
+            if (renderer.isRetained()) {
+                renderer.repaint();
+            } else {
+                invalidate();
+            }
+        }
+    }
+
+    void Game::invalidate() {
+        for (auto &sprite : sprites)
+            sprite->invalidate();
     }
 
     void Game::render() {
+        bool dirty = false;
+        for (auto &sprite : sprites)
+            dirty = sprite->isDirty() || dirty;
+        if (!dirty)
+            return;
+
+        // without a retained canvas the back buffer is undefined after a present
+        if (!renderer.isRetained())
+            invalidate();
+
+        renderer.beginFrame();
         for (auto &sprite : sprites)
-            sprite->render();
+            if (sprite->isDirty())
+                sprite->render();
         renderer.repaint();
     }
 }
@@ -1,23 +1,65 @@
 #ifndef MINESWEEPER_GAME_H
 #define MINESWEEPER_GAME_H
 
+#include <memory>
 #include <vector>
 #include "../sdl/ImageRepo.h"
 #include "../sdl/Renderer.h"
 #include "../config/Layout.h"
 #include "../config/Options.h"
+#include "../engine/Board.h"
+#include "../engine/Solver.h"
+#include "../engine/Probability.h"
+#include "../engine/Generator.h"
+#include "../engine/Dealer.h"
+#include "../engine/Recorder.h"
+#include "../replay/Playback.h"
+#include "../util/EventBus.h"
+#include "../util/ThreadPool.h"
+#include "Button.h"
+#include "Grid.h"
 #include "Sprite.h"
+#include "Timer.h"
 
 namespace minesweeper {
     class Game {
     public:
-        Game(ImageRepo &imageRepo, Renderer &renderer, const Options &options, const Layout &layout, Mode::Enum mode);
+        Game(ImageRepo &imageRepo, Renderer &renderer, const Options &options, const Layout &layout, Mode::Enum mode,
+             uint64_t seed, bool noGuess);
+        void setRecorder(Recorder *recorder);
+        void setPlayback(Playback *playback);
         void run();
+        void invalidate();
+        void render();
     private:
+        static constexpr int WHEEL_TILES = 3;
         Renderer &renderer;
+        const Options &options;
+        Board board;
+        Solver solver;
+        ThreadPool pool;
+        Probability probability;
+        // with no-guess deals, generation runs on its own workers, so probability never queues behind a search
+        std::unique_ptr<ThreadPool> background;
+        std::unique_ptr<Generator> generator;
+        Dealer dealer;
+        Playback *playback;
+        bool overlay;
+        GameState state;
+        TimerPtr timer;
+        ButtonPtr button;
+        GridPtr grid;
+        EventBus<Timer, Button> bus;
         std::vector<SpritePtr> sprites;
+        bool onEvent(SDL_Event &e);
         void onClick(SDL_MouseButtonEvent evt);
-        void render();
+        void onKey(SDL_KeyboardEvent evt);
+        void onScroll(int dx, int dy);
+        void hint();
+        void toggleOverlay();
+        void onMove();
+        [[nodiscard]] int getTimeout() const;
+        void onWindowEvent(SDL_WindowEvent evt);
     };
 };
 
@@ -1,53 +1,122 @@
+#include <algorithm>
 #include "Grid.h"
 
 namespace minesweeper {
-    Grid::Grid(ImageRepo &imageRepo, const Options &options, const Layout &layout) :
+    Grid::Grid(ImageRepo &imageRepo, Board &board, const Options &options, const Layout &layout) :
             Sprite(imageRepo, layout.getGrid()),
-            tiles{options.getRows(), options.getColumns()},
-            mineField(options),
-            options(options) {
-        auto fn = [&imageRepo, &layout, this](int r, int c, TilePtr &t) {
-            int adjacentMines = mineField.adjacentMines(r, c);
-            bool mine = mineField.mineAt(r, c);
-            SDL_Rect rect = layout.getTile(boundingBox.x, boundingBox.y, r, c);
-            t = std::make_shared<Tile>(imageRepo, rect, adjacentMines, mine);
-        };
-        tiles.forEach(fn);
-    }
-
-    void Grid::setListeners(const std::vector<TileListenerWPtr> &v) {
-        auto fe = [&v, this](int r, int c, TilePtr &t) {
-            std::vector<TileListenerWPtr> listeners = v;
-            auto fn = [&listeners, this](int r, int c) { listeners.push_back(tiles.at(r, c)); };
-            options.forEachNeighbor(r, c, fn);
-            t->setListeners(listeners);
-        };
-        tiles.forEach(fe);
+            board(board),
+            options(options),
+            layout(layout),
+            overlay(nullptr),
+            scrollX(0),
+            scrollY(0),
+            generation(board.getGeneration()),
+            changes(board.getChanges().size()),
+            batch(imageRepo.createBatch()),
+            firstRow(0),
+            firstCol(0),
+            lastRow(-1),
+            lastCol(-1) {
+
     }
 
     void Grid::handleClick(SDL_MouseButtonEvent evt) {
-        int col = (evt.x - boundingBox.x) / Layout::getTileSide();
-        int row = (evt.y - boundingBox.y) / Layout::getTileSide();
-        tiles.at(row, col)->handleClick(evt);
+        int col = (evt.x - boundingBox.x + scrollX) / Layout::getTileSide();
+        int row = (evt.y - boundingBox.y + scrollY) / Layout::getTileSide();
+        if (evt.button == SDL_BUTTON_LEFT) {
+            if (board.isRevealed(row, col)) {
+                board.clear(row, col);
+            } else {
+                board.reveal(row, col);
+            }
+        } else if (evt.button == SDL_BUTTON_RIGHT) {
+            board.toggleFlag(row, col);
+        }
+    }
+
+    void Grid::scroll(int dx, int dy) {
+        int x = std::clamp(scrollX + dx * Layout::getTileSide(), 0, layout.getGridWidth() - boundingBox.w);
+        int y = std::clamp(scrollY + dy * Layout::getTileSide(), 0, layout.getGridHeight() - boundingBox.h);
+        if (x != scrollX || y != scrollY) {
+            scrollX = x;
+            scrollY = y;
+            dirty = true;
+        }
     }
 
-    void Grid::onFlagStateChange(bool exhausted) {
-        tiles.forEach([exhausted](int r, int c, std::shared_ptr<Tile> &t) { t->onFlagStateChange(exhausted); });
+    bool Grid::isDirty() {
+        return dirty || board.getGeneration() != generation || board.getChanges().size() != changes;
     }
 
-    void Grid::onStateChange(GameState state) {
-        if (state == GameState::INIT) {
-            mineField.reset();
-            auto fn = [this](int r, int c, TilePtr &t) {
-                t->reset(mineField.adjacentMines(r, c), mineField.mineAt(r, c));
-            };
-            tiles.forEach(fn);
+    void Grid::render() {
+        if (dirty || board.getGeneration() != generation) {
+            layoutTiles();
+            batch.drawAll();
+        } else {
+            const std::vector<int> &cells = board.getChanges();
+            for (size_t i = changes; i < cells.size(); i++) {
+                int r = cells[i] / options.getColumns();
+                int c = cells[i] % options.getColumns();
+                if (r >= firstRow && r <= lastRow && c >= firstCol && c <= lastCol) {
+                    batch.draw(updateTile(r, c));
+                }
+            }
         }
+        batch.render();
+        generation = board.getGeneration();
+        changes = board.getChanges().size();
+        dirty = false;
+    }
 
-        tiles.forEach([state](int r, int c, std::shared_ptr<Tile> &t) { t->onStateChange(state); });
+    void Grid::setOverlay(const Probability *probability) {
+        overlay = probability;
+        dirty = true;
     }
 
-    void Grid::render() {
-        tiles.forEach([](int r, int c, TilePtr &t) { t->render(); });
+    // one quad per tile in the visible window, rebuilt whenever the whole viewport is redrawn
+    void Grid::layoutTiles() {
+        int side = Layout::getTileSide();
+        firstRow = scrollY / side;
+        firstCol = scrollX / side;
+        lastRow = std::min(options.getRows() - 1, (scrollY + boundingBox.h - 1) / side);
+        lastCol = std::min(options.getColumns() - 1, (scrollX + boundingBox.w - 1) / side);
+        batch.resize((lastRow - firstRow + 1) * (lastCol - firstCol + 1));
+        for (int r = firstRow; r <= lastRow; r++) {
+            for (int c = firstCol; c <= lastCol; c++) {
+                updateTile(r, c);
+            }
+        }
+    }
+
+    int Grid::updateTile(int row, int col) {
+        int quad = (row - firstRow) * (lastCol - firstCol + 1) + (col - firstCol);
+        SDL_Rect rect = layout.getTile(boundingBox.x - scrollX, boundingBox.y - scrollY, row, col);
+        batch.setQuad(quad, imageRepo.get(getImage(row, col)), &rect, &boundingBox, getTint(row, col));
+        return quad;
+    }
+
+    [[nodiscard]] Image::Enum Grid::getImage(int row, int col) const {
+        if (board.isRevealed(row, col)) {
+            if (board.isMine(row, col)) {
+                return Image::TILE_MINE;
+            } else {
+                return Image::tile(board.getAdjacentMines(row, col));
+            }
+        } else if (board.isFlagged(row, col)) {
+            return Image::TILE_FLAG;
+        } else {
+            return Image::TILE;
+        }
+    }
+
+    // hidden tiles shade from white to red with their mine chance, provably safe ones turn green
+    [[nodiscard]] SDL_Color Grid::getTint(int row, int col) const {
+        if (overlay == nullptr || board.isRevealed(row, col) || board.isFlagged(row, col))
+            return {255, 255, 255, 255};
+        float chance = overlay->getMineChance(row, col);
+        if (chance == 0.0f)
+            return {160, 255, 160, 255};
+        auto shade = static_cast<Uint8>(255.0f - 160.0f * chance);
+        return {255, shade, shade, 255};
     }
 }
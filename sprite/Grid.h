@@ -1,25 +1,38 @@
 #ifndef MINESWEEPER_GRID_H
 #define MINESWEEPER_GRID_H
 
-#include "../config/Options.h"
 #include "../config/Layout.h"
-#include "../util/Matrix.h"
-#include "Tile.h"
-#include "MineField.h"
+#include "../engine/Board.h"
+#include "../engine/Probability.h"
+#include "Sprite.h"
 
 namespace minesweeper {
-    class Grid : public Sprite, public GameStateListener, public FlagStateListener {
+    class Grid : public Sprite {
     public:
-        Grid(ImageRepo &imageRepo, const Options &options, const Layout &layout);
-        void setListeners(const std::vector<TileListenerWPtr> &v);
+        Grid(ImageRepo &imageRepo, Board &board, const Options &options, const Layout &layout);
         void handleClick(SDL_MouseButtonEvent evt) override;
-        void onFlagStateChange(bool exhausted) override;
-        void onStateChange(GameState state) override;
+        void scroll(int dx, int dy) override;
+        bool isDirty() override;
         void render() override;
+        void setOverlay(const Probability *probability);
     private:
-        Matrix<TilePtr> tiles;
-        MineField mineField;
+        Board &board;
         const Options &options;
+        const Layout &layout;
+        const Probability *overlay;
+        int scrollX;
+        int scrollY;
+        int generation;
+        size_t changes;
+        Batch batch;
+        int firstRow;
+        int firstCol;
+        int lastRow;
+        int lastCol;
+        void layoutTiles();
+        int updateTile(int row, int col);
+        [[nodiscard]] Image::Enum getImage(int row, int col) const;
+        [[nodiscard]] SDL_Color getTint(int row, int col) const;
     };
 
     using GridPtr = std::shared_ptr<Grid>;
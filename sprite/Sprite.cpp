@@ -1,7 +1,9 @@
 #include "Sprite.h"
 
 namespace minesweeper {
-    Sprite::Sprite(ImageRepo &imageRepo, SDL_Rect boundingBox) : imageRepo(imageRepo), boundingBox(boundingBox) {
+    Sprite::Sprite(ImageRepo &imageRepo, SDL_Rect boundingBox) : imageRepo(imageRepo),
+                                                                 boundingBox(boundingBox),
+                                                                 dirty(true) {
 
     }
 
@@ -25,4 +27,16 @@ namespace minesweeper {
     void Sprite::handleClick(SDL_MouseButtonEvent evt) {
 
     }
+
+    void Sprite::scroll(int dx, int dy) {
+
+    }
+
+    bool Sprite::isDirty() {
+        return dirty;
+    }
+
+    void Sprite::invalidate() {
+        dirty = true;
+    }
 }
\ No newline at end of file
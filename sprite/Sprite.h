@@ -1,6 +1,7 @@
 #ifndef MINESWEEPER_SPRITE_H
 #define MINESWEEPER_SPRITE_H
 
+#include <memory>
 #include "../sdl/ImageRepo.h"
 
 namespace minesweeper {
@@ -9,10 +10,14 @@ namespace minesweeper {
         void onClick(SDL_MouseButtonEvent evt) ;
         virtual void render();
         virtual void handleClick(SDL_MouseButtonEvent evt);
+        virtual void scroll(int dx, int dy);
+        virtual bool isDirty();
+        void invalidate();
         virtual ~Sprite() = default;
     protected:
         ImageRepo &imageRepo;
         SDL_Rect boundingBox;
+        bool dirty;
         bool contains(int x, int y);
         Sprite(ImageRepo &imageRepo, SDL_Rect boundingBox);
     };
@@ -1,15 +0,0 @@
-#include "TileListener.h"
-
-namespace minesweeper {
-    void TileListener::onReveal(bool mine, bool adjacentMines) {
-
-    }
-
-    void TileListener::onClear() {
-
-    }
-
-    void TileListener::onFlag(bool flagged) {
-
-    }
-}
\ No newline at end of file
@@ -14,13 +14,19 @@ namespace minesweeper {
         return running ? static_cast<int>(timer.elapsed()) : elapsed;
     }
 
-    void Timer::onStateChange(GameState state) {
+    // milliseconds until the displayed value next changes, or -1 when it is frozen
+    [[nodiscard]] int Timer::getTimeout() const {
+        return running ? timer.untilNextSecond() : -1;
+    }
+
+    // a game won or lost by its very first move never reaches the playing state
+    void Timer::onEvent(GameState state) {
         if (state == GameState::PLAYING) {
             running = true;
             timer.reset();
         } else if (state == GameState::WON || state == GameState::LOST) {
+            elapsed = running ? static_cast<int>(timer.elapsed()) : 0;
             running = false;
-            elapsed = static_cast<int>(timer.elapsed());
         } else {
             running = false;
             elapsed = 0;
@@ -5,15 +5,16 @@
 #include "../config/Layout.h"
 #include "../sdl/ImageRepo.h"
 #include "DigitPanel.h"
-#include "GameStateListener.h"
+#include "../engine/GameState.h"
 
 namespace minesweeper {
-    class Timer : public DigitPanel, public GameStateListener {
+    class Timer : public DigitPanel {
     public:
         Timer(ImageRepo &imageRepo, const Layout &layout);
         SDL_Rect getDigitRect(int position) override;
         int getDisplayValue() override;
-        void onStateChange(GameState state) override;
+        void onEvent(GameState state);
+        [[nodiscard]] int getTimeout() const;
     private:
         const Layout &layout;
         ClockTimer timer;
@@ -0,0 +1,27 @@
+#ifndef MINESWEEPER_BITS_H
+#define MINESWEEPER_BITS_H
+
+#include <cstdint>
+
+namespace minesweeper {
+    inline int popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(word);
+#else
+        int n = 0;
+        for (; word != 0; word &= word - 1)
+            n++;
+        return n;
+#endif
+    }
+
+    inline int countTrailingZeros(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        return popcount((word & (~word + 1)) - 1);
+#endif
+    }
+}
+
+#endif
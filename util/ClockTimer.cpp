@@ -11,4 +11,9 @@ namespace minesweeper {
     [[nodiscard]] double ClockTimer::elapsed() const {
         return std::chrono::duration_cast<second_t>(clock_t::now() - start).count();
     }
+
+    [[nodiscard]] int ClockTimer::untilNextSecond() const {
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(clock_t::now() - start).count();
+        return static_cast<int>(1000 - millis % 1000);
+    }
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ namespace minesweeper {
         ClockTimer();
         void reset();
         [[nodiscard]] double elapsed() const;
+        [[nodiscard]] int untilNextSecond() const;
     private:
         using clock_t = std::chrono::high_resolution_clock;
         using second_t = std::chrono::duration<double, std::ratio<1> >;
@@ -0,0 +1,48 @@
+#ifndef MINESWEEPER_EVENTBUS_H
+#define MINESWEEPER_EVENTBUS_H
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace minesweeper {
+    // delivers each event to the fixed set of subscribers that declare an onEvent overload for its type;
+    // the subscriber list is part of the type, so a publish compiles down to direct calls
+    template<typename... Subscribers>
+    class EventBus {
+    public:
+        explicit EventBus(Subscribers &... subscribers);
+        template<typename Event>
+        void publish(const Event &event) const;
+    private:
+        template<typename Subscriber, typename Event, typename = void>
+        struct Handles : std::false_type {
+        };
+
+        template<typename Subscriber, typename Event>
+        struct Handles<Subscriber, Event,
+                std::void_t<decltype(std::declval<Subscriber &>().onEvent(std::declval<const Event &>()))>>
+                : std::true_type {
+        };
+
+        std::tuple<Subscribers &...> subscribers;
+    };
+
+    template<typename... Subscribers>
+    EventBus<Subscribers...>::EventBus(Subscribers &... subscribers) : subscribers(subscribers...) {
+
+    }
+
+    template<typename... Subscribers>
+    template<typename Event>
+    void EventBus<Subscribers...>::publish(const Event &event) const {
+        std::apply([&event](auto &... subscriber) {
+            ([&event](auto &s) {
+                if constexpr (Handles<std::remove_reference_t<decltype(s)>, Event>::value)
+                    s.onEvent(event);
+            }(subscriber), ...);
+        }, subscribers);
+    }
+}
+
+#endif
@@ -1,16 +1,24 @@
 #ifndef MINESWEEPER_MATRIX_H
 #define MINESWEEPER_MATRIX_H
 
-#include <set>
-#include <functional>
+#include <cassert>
+#include <vector>
 
 namespace minesweeper {
+    // row-major storage; element access is bounds-checked in debug builds only
     template<typename T>
     class Matrix {
     public:
         Matrix(int rows, int columns);
         T &at(int row, int col);
-        void forEach(std::function<void(int row, int col, T &val)> fn);
+        const T &at(int row, int col) const;
+        T *getRow(int row);
+        const T *getRow(int row) const;
+        T *data();
+        const T *data() const;
+        [[nodiscard]] int size() const;
+        template<typename Fn>
+        void forEach(Fn &&fn);
     private:
         int rows;
         int columns;
@@ -24,17 +32,53 @@ namespace minesweeper {
 
     template<typename T>
     T &Matrix<T>::at(int row, int col) {
+        assert(row >= 0 && row < rows && col >= 0 && col < columns);
         int n = row * columns + col;
         return matrix[n];
     }
 
     template<typename T>
-    void Matrix<T>::forEach(std::function<void(int row, int col, T &val)> fn) {
-        for (int i = 0; i < matrix.size(); i++) {
-            int row = i / columns;
-            int col = i % columns;
-            fn(row, col, matrix[i]);
-        }
+    const T &Matrix<T>::at(int row, int col) const {
+        assert(row >= 0 && row < rows && col >= 0 && col < columns);
+        int n = row * columns + col;
+        return matrix[n];
+    }
+
+    // the columns elements of a row, contiguous
+    template<typename T>
+    T *Matrix<T>::getRow(int row) {
+        assert(row >= 0 && row < rows);
+        return matrix.data() + row * columns;
+    }
+
+    template<typename T>
+    const T *Matrix<T>::getRow(int row) const {
+        assert(row >= 0 && row < rows);
+        return matrix.data() + row * columns;
+    }
+
+    template<typename T>
+    T *Matrix<T>::data() {
+        return matrix.data();
+    }
+
+    template<typename T>
+    const T *Matrix<T>::data() const {
+        return matrix.data();
+    }
+
+    template<typename T>
+    [[nodiscard]] int Matrix<T>::size() const {
+        return rows * columns;
+    }
+
+    template<typename T>
+    template<typename Fn>
+    void Matrix<T>::forEach(Fn &&fn) {
+        T *val = matrix.data();
+        for (int row = 0; row < rows; row++)
+            for (int col = 0; col < columns; col++)
+                fn(row, col, *val++);
     }
 }
 
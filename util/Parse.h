@@ -0,0 +1,21 @@
+#ifndef MINESWEEPER_PARSE_H
+#define MINESWEEPER_PARSE_H
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
+namespace minesweeper {
+    // false unless the whole text is a decimal number that fits an int
+    inline bool parseInt(const char *text, int &value) {
+        char *end = nullptr;
+        errno = 0;
+        long parsed = std::strtol(text, &end, 10);
+        if (end == text || *end != '\0' || errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX)
+            return false;
+        value = static_cast<int>(parsed);
+        return true;
+    }
+}
+
+#endif
@@ -1,12 +1,55 @@
+#include <chrono>
+#include <random>
 #include "Random.h"
 
 namespace minesweeper {
-    Random::Random() : mersenne{static_cast<std::mt19937::result_type>(std::time(nullptr))} {
+    Random::Random(uint64_t seed) : state{} {
+        for (uint64_t &s : state) {
+            s = splitMix(seed);
+        }
+    }
 
+    // xoshiro256**
+    Random::result_type Random::operator()() {
+        auto rotl = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
     }
 
+    // Lemire's nearly divisionless bounded integer, unbiased over [min, max]
     int Random::randomInt(int min, int max) {
-        std::uniform_int_distribution die{min, max};
-        return die(mersenne);
+        auto range = static_cast<uint32_t>(max - min) + 1;
+        uint64_t m = ((*this)() >> 32) * range;
+        if (static_cast<uint32_t>(m) < range) {
+            uint32_t threshold = -range % range;
+            while (static_cast<uint32_t>(m) < threshold) {
+                m = ((*this)() >> 32) * range;
+            }
+        }
+        return min + static_cast<int>(m >> 32);
+    }
+
+    uint64_t Random::nextSeed(uint64_t seed) {
+        return splitMix(seed);
+    }
+
+    uint64_t Random::randomSeed() {
+        std::random_device device;
+        uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+        return seed ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    uint64_t Random::splitMix(uint64_t &x) {
+        uint64_t z = (x += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
     }
 }
@@ -1,15 +1,23 @@
 #ifndef MINESWEEPER_RANDOM_H
 #define MINESWEEPER_RANDOM_H
 
-#include <random>
+#include <cstdint>
+#include <limits>
 
 namespace minesweeper {
     class Random {
     public:
-        Random();
+        using result_type = uint64_t;
+        explicit Random(uint64_t seed);
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+        result_type operator()();
         int randomInt(int min, int max);
+        static uint64_t nextSeed(uint64_t seed);
+        static uint64_t randomSeed();
     private:
-        std::mt19937 mersenne;
+        uint64_t state[4];
+        static uint64_t splitMix(uint64_t &x);
     };
 };
 
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include "ThreadPool.h"
+
+namespace minesweeper {
+    namespace {
+        thread_local const ThreadPool *owner = nullptr;
+        thread_local int worker = -1;
+    }
+
+    ThreadPool::Group::Group() : pending(0) {
+
+    }
+
+    ThreadPool::ThreadPool(int threads) : queued(0), next(0), stopping(false) {
+        if (threads <= 0)
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        for (int i = 0; i < threads; i++)
+            queues.push_back(std::make_unique<Queue>());
+        for (int i = 0; i < threads; i++)
+            workers.emplace_back(&ThreadPool::work, this, i);
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        available.notify_all();
+        for (auto &thread : workers)
+            thread.join();
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        submit(tasks, std::move(task));
+    }
+
+    // tasks submitted from a worker stay on its own queue, others are dealt round-robin
+    void ThreadPool::submit(Group &group, std::function<void()> task) {
+        int self = owner == this ? worker : static_cast<int>(next++ % queues.size());
+        group.pending++;
+        {
+            std::lock_guard<std::mutex> lock(queues[self]->mutex);
+            queues[self]->tasks.push_back({std::move(task), &group});
+        }
+        queued++;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        available.notify_one();
+    }
+
+    // blocks until every task submitted without a group has finished; must not be called from a task
+    void ThreadPool::wait() {
+        wait(tasks);
+    }
+
+    void ThreadPool::wait(Group &group) {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [&group] { return group.pending == 0; });
+    }
+
+    [[nodiscard]] int ThreadPool::getThreads() const {
+        return static_cast<int>(workers.size());
+    }
+
+    // newest task from the worker's own queue, otherwise the oldest one stolen from another queue
+    bool ThreadPool::pop(int self, Task &task) {
+        int count = static_cast<int>(queues.size());
+        for (int i = 0; i < count; i++) {
+            Queue &queue = *queues[(self + i) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            queued--;
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::work(int self) {
+        owner = this;
+        worker = self;
+        Task task;
+        while (true) {
+            if (pop(self, task)) {
+                task.run();
+                task.run = nullptr;
+                // the group may be gone once its count reaches zero, so it is not touched after that
+                if (--task.group->pending == 0) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    idle.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || queued > 0; });
+            if (stopping && queued == 0)
+                return;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef MINESWEEPER_THREADPOOL_H
+#define MINESWEEPER_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace minesweeper {
+    class ThreadPool {
+    public:
+        // tasks that are waited for together, apart from whatever else runs on the pool
+        class Group {
+        public:
+            Group();
+        private:
+            friend class ThreadPool;
+            std::atomic<int> pending;
+        };
+
+        explicit ThreadPool(int threads = 0);
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+        ~ThreadPool();
+        void submit(std::function<void()> task);
+        void submit(Group &group, std::function<void()> task);
+        void wait();
+        void wait(Group &group);
+        [[nodiscard]] int getThreads() const;
+    private:
+        struct Task {
+            std::function<void()> run;
+            Group *group;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<int> queued;
+        Group tasks;
+        std::atomic<unsigned> next;
+        std::mutex mutex;
+        std::condition_variable available;
+        std::condition_variable idle;
+        bool stopping;
+        bool pop(int self, Task &task);
+        void work(int self);
+    };
+};
+
+#endif